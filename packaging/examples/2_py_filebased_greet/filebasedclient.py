@@ -20,6 +20,10 @@ Main functions:
       - For other commands: writes request.txt, waits for reply.txt, then deletes it.
       Typical commands: get`, set`, new`, events?
 
+  • request_batch(commands)
+      Sends many requests at once as numbered request files and returns the
+      replies in the same order. PeasyGUI treats all of them in one go.
+
   • close(timeout_seconds=3.0)
       Terminates the PeasyGUI process and removes the temporary exchange directory.
 
@@ -40,6 +44,7 @@ import glob
 
 exchange_dir = None
 gui_process = None
+request_file_index = 0
 
 def _select_exchange_dir():  #############################################################
     if sys.platform.startswith('linux') and os.path.isdir('/dev/shm'):
@@ -98,10 +103,30 @@ def _write_request_file(payload_utf8):
     os.rename(draft_path, request_path)
 
 
-def _read_and_delete_reply_file():  ######################################################
+def _write_numbered_request_file(payload_utf8):  ##########################################
+    global exchange_dir
+    global request_file_index
+
+    request_file_index += 1
+    prefix = '%012d' % request_file_index
+
+    draft_path = os.path.join(exchange_dir, prefix + '_request_draft.txt')
+    request_path = os.path.join(exchange_dir, prefix + '_request.txt')
+
+    with open(draft_path, 'w', encoding='utf-8') as f:
+        f.write(payload_utf8)
+        f.flush()
+        os.fsync(f.fileno())
+
+    os.rename(draft_path, request_path)
+
+    return prefix + '_reply.txt'
+
+
+def _read_and_delete_reply_file(reply_name='reply.txt'):  ################################
     global exchange_dir
     
-    reply_path = os.path.join(exchange_dir, 'reply.txt')
+    reply_path = os.path.join(exchange_dir, reply_name)
     
     while not os.path.exists(reply_path):
         time.sleep(0.02)
@@ -219,3 +244,29 @@ def request(command): ##########################################################
 
     return reply
 
+
+def request_batch(commands): #############################################################
+    """
+    Send several requests (list of strings) without waiting for each reply.
+    Returns the list of replies in the same order. 'events?' is not allowed here.
+    """
+    global exchange_dir
+
+    if exchange_dir is None:
+        raise RuntimeError('call init() first')
+
+    reply_names = [_write_numbered_request_file(command) for command in commands]
+
+    replies = []
+    for command, reply_name in zip(commands, reply_names):
+        reply = _read_and_delete_reply_file(reply_name)
+
+        if reply.startswith('ERROR`'):
+            raise ValueError(reply)
+
+        if command.startswith('get`'):
+            reply = reply.replace('OK`', '', 1)[:-1]
+
+        replies.append(reply)
+
+    return replies
@@ -178,7 +178,8 @@ def show_image(idx_up_down):
     request('set`image_view`Image`' + current_image_pathes[current_img] + '`\n' + \
             'set`file_list`Selected`' + str(current_img) + '`\n')
     
-    set_zoom_slider_to_current_shrink()
+    # The image is decoded in the background, the zoom slider is set
+    # when it is shown (ImageLoaded event)
 
 ##########################################################################################
 def show_image_by_click_pos(event):
@@ -246,6 +247,9 @@ while True:
     elif event.startswith('image_view`ClickedAtPos'):
       show_image_by_click_pos(event)
       
+    elif event.startswith('image_view`ImageLoaded'):
+      set_zoom_slider_to_current_shrink()
+      
     elif event.startswith('file_list`SelectionChanged'):
       show_image(ev_val_str(event))
       
@@ -5,6 +5,7 @@
 
 #include "apppaths.h"
 #include "controlprototypes.h"
+#include "propid.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -92,10 +93,20 @@ QString AboutDialog::getHelpIntro()
 "If the button named ok_button is clicked, then the window is resized and    \n"
 "finally closed, PeasyGUI will respond with:                                 \n"
 "ok_button`Clicked`                                                          \n"
-"Window`Resized`346,549`                                                     \n"
 "Window`Resized`370,566`                                                     \n"
 "Window`Closed`                                                              \n"
 "                                                                            \n"
+"Events that describe a state (Moved, Resized, SelectionChanged) are         \n"
+"coalesced: if the same control sends such an event again before you ask,    \n"
+"only the latest one is kept. A Slider can additionally be limited to a      \n"
+"number of Moved events per second with the property MaxEventRate.           \n"
+"                                                                            \n"
+"At most 10000 events are kept (Window property EventQueueLimit). If your    \n"
+"program does not ask for a while, the oldest events are dropped and the     \n"
+"next reply starts with Window`EventsDropped`<count>`. With the Window       \n"
+"property EventChunkSize a reply contains at most that many events; the      \n"
+"rest is returned by the following events? requests.                         \n"
+"                                                                            \n"
 "If no events occurred in the meantime, the reply will be:                   \n"
 "NONE                                                                        \n"
 "                                                                            \n"
@@ -119,6 +130,18 @@ QString AboutDialog::getHelpIntro()
 "PeasyGUI will respond with:                                                 \n"
 "OK`dog`cat`mouse`                                                           \n"
 "                                                                            \n"
+"Big values can be read in pages by adding offset,length. Entire properties  \n"
+"are paged by entries, all others by characters:                             \n"
+"get`ListBox_7`EntireTexts`1,2`                                              \n"
+"                                                                            \n"
+"PeasyGUI will respond with:                                                 \n"
+"OK`cat`mouse`                                                               \n"
+"                                                                            \n"
+"Paged by characters, a page that is shorter than asked for is the last one. \n"
+"Paged by entries, this does not work: a page of one empty entry looks just  \n"
+"like a page past the end. Ask ListBox and DropDown for their number of      \n"
+"entries first, with get`ListBox_7`ItemCount`, and page up to it.            \n"
+"                                                                            \n"
 "                                                                            \n"
 "The 'set' Request                                                           \n"
 "-----------------                                                           \n"
@@ -137,6 +160,14 @@ QString AboutDialog::getHelpIntro()
 "bc                                                                          \n"
 "def                                                                         \n"
 "                                                                            \n"
+"To change a long list without sending it again, use AppendTexts,            \n"
+"InsertTexts, ReplaceTexts (row first, then the entries) or RemoveRows       \n"
+"(first row, count), for example:                                            \n"
+"set`MyListBox`AppendTexts`ghi`jk`                                           \n"
+"set`MyListBox`InsertTexts`0`first`                                          \n"
+"set`MyListBox`ReplaceTexts`2`BC`                                            \n"
+"set`MyListBox`RemoveRows`1,2`                                               \n"
+"                                                                            \n"
 "                                                                            \n"
 "The 'new' Request                                                           \n"
 "-----------------                                                           \n"
@@ -150,6 +181,89 @@ QString AboutDialog::getHelpIntro()
 "have default properties, which can then be modified using set requests.     \n"
 "                                                                            \n"
 "                                                                            \n"
+"Framed TCP Messages                                                         \n"
+"-------------------                                                         \n"
+"A single TCP read does not always match a single request: big requests may  \n"
+"arrive in several pieces and quickly sent requests may arrive together.     \n"
+"Start PeasyGUI with --framing=length to avoid this. Then every message in   \n"
+"both directions is preceded by its size in bytes, written as a 4-byte       \n"
+"unsigned big-endian integer (e.g. Python: struct.pack('>I', len(data))).    \n"
+"                                                                            \n"
+"With framing, requests may be sent one after another without waiting for    \n"
+"each reply. The replies arrive in the same order.                           \n"
+"                                                                            \n"
+"                                                                            \n"
+"Request IDs                                                                 \n"
+"-----------                                                                 \n"
+"A request may start with an ID of your choice: #ID` (hash, ID, backtick).   \n"
+"The reply to it then starts with the same #ID`, for example:                \n"
+"#42`get`TextBox_0`Text`                                                     \n"
+"is answered with:                                                           \n"
+"#42`OK`Hello, World!`                                                       \n"
+"                                                                            \n"
+"This way several requests can be in flight at the same time and every       \n"
+"reply can be matched to its request. This needs --framing=length: without   \n"
+"framing, requests sent shortly after each other may arrive as one message,  \n"
+"which gets a single reply and can no longer be matched to all its IDs.      \n"
+"                                                                            \n"
+"                                                                            \n"
+"Pushed Events                                                               \n"
+"-------------                                                               \n"
+"Instead of asking for events? again and again, PeasyGUI can send events to  \n"
+"your program the moment they occur. Start it with a second port, e.g.       \n"
+"--push_port=10001, and connect a second socket to it. Every event is then   \n"
+"written to this socket immediately, in the same format as the reply to      \n"
+"events? (framed, if --framing=length is used). While this socket is         \n"
+"connected, events? always replies NONE.                                     \n"
+"                                                                            \n"
+"                                                                            \n"
+"Several Clients                                                             \n"
+"---------------                                                             \n"
+"By default PeasyGUI talks to one TCP client; a new connection replaces the  \n"
+"old one. With --max_clients=N up to N programs can be connected at once,    \n"
+"e.g. one that controls the GUI and one that only monitors it. Each client   \n"
+"gets the replies to its own requests. Requests of all clients are treated   \n"
+"one after another in the order they arrive. Pushed events are sent to all   \n"
+"clients connected to --push_port. If more than N clients connect, the       \n"
+"oldest one is disconnected.                                                 \n"
+"                                                                            \n"
+"                                                                            \n"
+"Local Sockets                                                               \n"
+"-------------                                                               \n"
+"If your program runs on the same computer, --protocol=local is a faster     \n"
+"alternative to TCP. PeasyGUI then listens on a local socket (Linux, macOS)  \n"
+"or a named pipe (Windows) instead of a TCP port. The name is given with     \n"
+"--socket_name (default: PeasyGUI), the full path is printed at startup.     \n"
+"Requests, replies and --framing work exactly as with TCP. Events are        \n"
+"pushed to a second socket with the suffix _events, e.g. PeasyGUI_events.    \n"
+"                                                                            \n"
+"                                                                            \n"
+"Binary Requests                                                             \n"
+"---------------                                                             \n"
+"Programs that send many requests (e.g. for sliders and tables) can skip the \n"
+"text format. A TCP or local socket client that sends the 4 bytes PGB1 as    \n"
+"its first message gets OK and from then on sends length framed binary       \n"
+"messages (framing is used even without --framing=length). The OK and all    \n"
+"later replies and events are length framed as well. Each message carries a  \n"
+"request ID and a number of requests; a property is given by its number      \n"
+"instead of its name (see the list at the end of this help) and a value is   \n"
+"either text or a list of 32-bit integers. A get may carry an offset and     \n"
+"length for paging. The layout is described in binaryrequestcodec.h. This    \n"
+"only saves splitting and escaping text: integers are turned into text when  \n"
+"a message arrives and are then checked and used like text values. Replies   \n"
+"and events stay text, exactly as described above.                           \n"
+"                                                                            \n"
+"                                                                            \n"
+"Shared Memory                                                               \n"
+"-------------                                                               \n"
+"For very high update rates (e.g. dashboards with hundreds of updates per    \n"
+"second) PeasyGUI can be started with --protocol=shm. Requests and replies   \n"
+"are then exchanged through two ring buffers in a shared memory segment      \n"
+"with the native key given by --shm_key (default: PeasyGUI). Messages in     \n"
+"the rings are framed like with --framing=length; request IDs work as well.  \n"
+"The exact memory layout is described in sharedmemoryserver.h.               \n"
+"                                                                            \n"
+"                                                                            \n"
 "File-Based Communication                                                    \n"
 "------------------------                                                    \n"
 "The file-based communication mode (--protocol=filebased) works but is       \n"
@@ -160,6 +274,15 @@ QString AboutDialog::getHelpIntro()
 "However, because it relies on disk file exchanges for every request, it     \n"
 "becomes inefficient, especially for frequent get requests.                  \n"
 "                                                                            \n"
+"PeasyGUI watches the exchange directory, so a request file is picked up as  \n"
+"soon as it has been renamed to request.txt. Events are written to numbered  \n"
+"*_events.txt files the moment they occur.                                   \n"
+"                                                                            \n"
+"To send many requests at once, write them as numbered files instead:        \n"
+"000000000001_request.txt, 000000000002_request.txt and so on. All of them   \n"
+"are treated in order in one go, and each one is answered with a matching    \n"
+"000000000001_reply.txt, 000000000002_reply.txt ...                          \n"
+"                                                                            \n"
 "                                                                            \n"
 "                                                                            \n"
 "Building Your GUI                                                           \n"
@@ -368,6 +491,14 @@ QString AboutDialog::makePropHelp()
         lines << "";
     }
 
+    lines << "# Property numbers for binary requests";
+
+    for (int idx = 0; idx < propCount; idx++) {
+        lines << QString("  %1  %2").arg(idx, 3).arg(propNameOf(PropId(idx)));
+    }
+
+    lines << "";
+
     return lines.join('\n');
 }
 
@@ -9,6 +9,8 @@
 enum class AppMode {
     Designer,
     TCP,
+    Local,
+    SharedMemory,
     FileBased
 };
 
@@ -17,7 +19,12 @@ struct AppConfig {
     QString iniPath;
     QString exchangeDir;
     QString ip;
+    QString socketName;
+    QString shmKey;
     quint16 port;
+    quint16 pushPort = 0;
+    int maxClients = 1;
+    bool framed = false;
 };
 
 #endif // APPCONFIG_H
@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "binaryrequestcodec.h"
+
+#include <QtEndian>
+
+// Reads the payload front to back, every read checks the remaining size
+class BinaryRequestCodec::Reader
+{
+public:
+    explicit Reader(const QByteArray &data) : data(data) {}
+
+    template <typename T>
+    bool read(T &out)
+    {
+        if (data.size() - pos < qsizetype(sizeof(T))) {
+            return false;
+        }
+        out = qFromBigEndian<T>(data.constData() + pos);
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool readUtf8(qsizetype length, QString &out)
+    {
+        if (length < 0 || data.size() - pos < length) {
+            return false;
+        }
+        out = QString::fromUtf8(data.constData() + pos, length);
+        pos += length;
+        return true;
+    }
+
+    bool atEnd() const
+    {
+        return pos == data.size();
+    }
+
+private:
+    const QByteArray &data;
+    qsizetype pos = 0;
+};
+
+
+const QByteArray &BinaryRequestCodec::hello()
+{
+    static const QByteArray magic("PGB1");
+    return magic;
+}
+
+
+// As with parseAll(), the last request carries the error, if there is one
+QList<Request> BinaryRequestCodec::decode(const QByteArray &payload, QString &requestId)
+{
+    QList<Request> requests;
+    Reader reader(payload);
+
+    auto fail = [&requests](const QString &error) {
+        Request request;
+        request.action = "No valid action";
+        request.error = error;
+        requests.append(request);
+        return requests;
+    };
+
+    quint16 idLength = 0;
+    quint16 count = 0;
+
+    if ( ! reader.read(idLength) || ! reader.readUtf8(idLength, requestId) || ! reader.read(count)) {
+        return fail("Binary request header incomplete");
+    }
+
+    requests.reserve(count);
+
+    for (int idx = 0; idx < count; idx++) {
+        Request request;
+        quint8 action = 0;
+
+        if ( ! reader.read(action)) {
+            return fail("Binary request incomplete");
+        }
+
+        if (action == Events) {
+            request.action = "events?";
+            requests.append(request);
+            continue;
+        }
+
+        if (action == New) {
+            request.action = "new";
+        } else if (action == Set) {
+            request.action = "set";
+        } else if (action == Get) {
+            request.action = "get";
+        } else {
+            return fail("Unknown binary action: " + QString::number(action));
+        }
+
+        quint32 nameLength = 0;
+        quint16 propNumber = 0;
+
+        if ( ! reader.read(nameLength) || ! reader.readUtf8(nameLength, request.name) || ! reader.read(propNumber)) {
+            return fail("Binary request incomplete");
+        }
+
+        if (propNumber >= propCount) {
+            return fail("Unknown property number: " + QString::number(propNumber));
+        }
+        request.prop = propNameOf(PropId(propNumber));
+
+        if (action == Get) {
+            quint8 hasRange = 0;
+
+            if ( ! reader.read(hasRange)) {
+                return fail("Range missing");
+            }
+
+            if (hasRange == 1) {
+                quint32 offset = 0;
+                quint32 length = 0;
+
+                if ( ! reader.read(offset) || ! reader.read(length)) {
+                    return fail("Range missing");
+                }
+
+                request.value = QString::number(offset) + ',' + QString::number(length);
+
+            } else if (hasRange != 0) {
+                return fail("Unknown binary range kind: " + QString::number(hasRange));
+            }
+
+        } else {
+            quint8 kind = 0;
+
+            if ( ! reader.read(kind)) {
+                return fail("Value missing");
+            }
+
+            if (kind == 0) {
+                quint32 valueLength = 0;
+
+                if ( ! reader.read(valueLength) || ! reader.readUtf8(valueLength, request.value)) {
+                    return fail("Value missing");
+                }
+
+            } else if (kind == 1) {
+                quint16 intCount = 0;
+
+                if ( ! reader.read(intCount)) {
+                    return fail("Value missing");
+                }
+
+                // Properties are stored and checked as text, so the numbers
+                // are not carried on as such. They go into the same text a
+                // text request would have, the controls convert it back.
+                request.value.reserve(intCount * 6);
+
+                for (int idxInt = 0; idxInt < intCount; idxInt++) {
+                    qint32 number = 0;
+
+                    if ( ! reader.read(number)) {
+                        return fail("Value missing");
+                    }
+
+                    if (idxInt > 0) {
+                        request.value += ',';
+                    }
+                    request.value += QString::number(number);
+                }
+
+            } else {
+                return fail("Unknown binary value kind: " + QString::number(kind));
+            }
+        }
+
+        requests.append(request);
+    }
+
+    if ( ! reader.atEnd()) {
+        return fail("Unexpected bytes after the last binary request");
+    }
+
+    return requests;
+}
+
+
+static void appendBigEndian16(QByteArray &payload, quint16 number)
+{
+    char bytes[2];
+    qToBigEndian(number, bytes);
+    payload.append(bytes, 2);
+}
+
+
+static void appendBigEndian32(QByteArray &payload, quint32 number)
+{
+    char bytes[4];
+    qToBigEndian(number, bytes);
+    payload.append(bytes, 4);
+}
+
+
+void BinaryRequestCodec::appendRequestHeader(QByteArray &payload, const QString &requestId, int requestCount)
+{
+    QByteArray id = requestId.toUtf8();
+
+    appendBigEndian16(payload, quint16(id.size()));
+    payload.append(id);
+    appendBigEndian16(payload, quint16(requestCount));
+}
+
+
+void BinaryRequestCodec::appendRequest(QByteArray &payload, Action action, const QString &name, PropId prop)
+{
+    payload.append(char(action));
+
+    if (action == Events) {
+        return;
+    }
+
+    QByteArray nameBytes = name.toUtf8();
+
+    appendBigEndian32(payload, quint32(nameBytes.size()));
+    payload.append(nameBytes);
+    appendBigEndian16(payload, quint16(prop));
+}
+
+
+void BinaryRequestCodec::appendStringValue(QByteArray &payload, const QString &value)
+{
+    QByteArray valueBytes = value.toUtf8();
+
+    payload.append(char(0));
+    appendBigEndian32(payload, quint32(valueBytes.size()));
+    payload.append(valueBytes);
+}
+
+
+void BinaryRequestCodec::appendIntsValue(QByteArray &payload, const QList<qint32> &values)
+{
+    payload.append(char(1));
+    appendBigEndian16(payload, quint16(values.size()));
+
+    for (qint32 value : values) {
+        appendBigEndian32(payload, quint32(value));
+    }
+}
+
+
+void BinaryRequestCodec::appendNoRange(QByteArray &payload)
+{
+    payload.append(char(0));
+}
+
+
+void BinaryRequestCodec::appendRange(QByteArray &payload, quint32 offset, quint32 length)
+{
+    payload.append(char(1));
+    appendBigEndian32(payload, offset);
+    appendBigEndian32(payload, length);
+}
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef BINARYREQUESTCODEC_H
+#define BINARYREQUESTCODEC_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+
+#include "request.h"
+#include "propid.h"
+
+// Compact binary alternative to the backtick text format. A client that
+// sends the 4 bytes "PGB1" as its first message switches its connection
+// to it. From then on every message is length framed (like
+// --framing=length) and its payload is decoded directly into requests,
+// without the text tokenizer. Replies stay text.
+//
+// All integers are big-endian:
+//   payload  := idLength:u16 requestId:utf8 count:u16 request*count
+//   request  := action:u8 [name:string prop:u16 (value | range)]
+//   action   := 1 new | 2 set | 3 get | 4 events?
+//   string   := length:u32 utf8
+//   value    := 0:u8 string | 1:u8 count:u16 int32*count
+//   range    := 0:u8 | 1:u8 offset:u32 length:u32
+//
+// prop is the number of the property in PropId (propid.h, also listed in
+// the help), new uses Type with the control type as string value. new and
+// set carry a value, get carries a range (0 for the whole value). Integer lists become the
+// comma separated text the controls expect, a range becomes offset,length.
+// Only the tokenizing is saved: the checker and the controls still see
+// and convert text values.
+class BinaryRequestCodec
+{
+public:
+    static const QByteArray &hello();
+
+    enum Action : quint8 {
+        New = 1,
+        Set = 2,
+        Get = 3,
+        Events = 4
+    };
+
+    static QList<Request> decode(const QByteArray &payload, QString &requestId);
+
+    // Encoding is only needed by clients, here it serves the tests
+    static void appendRequestHeader(QByteArray &payload, const QString &requestId, int requestCount);
+    static void appendRequest(QByteArray &payload, Action action, const QString &name = QString(), PropId prop = PropId::Unknown);
+    static void appendStringValue(QByteArray &payload, const QString &value);
+    static void appendIntsValue(QByteArray &payload, const QList<qint32> &values);
+    static void appendNoRange(QByteArray &payload);
+    static void appendRange(QByteArray &payload, quint32 offset, quint32 length);
+
+private:
+    class Reader;
+};
+
+#endif // BINARYREQUESTCODEC_H
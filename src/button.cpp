@@ -11,19 +11,19 @@ Button::Button(QWidget *parent) : QPushButton(parent), Control(parent)
 }
 
 
-void Button::setSpecificProp(const QString& prop, const QString& value)
+void Button::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         this->setText(value);
     }
 }
 
 
-QString Button::getSpecificProp(const QString& prop)
+QString Button::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         value = this->text();
     }
 
@@ -33,8 +33,8 @@ QString Button::getSpecificProp(const QString& prop)
 
 void Button::processClick()
 {
-    if (propsDict["Events"].contains("Clicked")) {
-        emit buttonEvent(propsDict["Name"], "Clicked");
+    if (hasEvent(ControlEvent::Clicked)) {
+        emit buttonEvent(propSlots[PropId::Name], "Clicked");
     }
 }
 
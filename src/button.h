@@ -14,8 +14,8 @@ class Button : public QPushButton, public Control
 public:
     explicit Button(QWidget *parent = 0);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 signals:
     void buttonEvent(const QString &name, const QString &event);
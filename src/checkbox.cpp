@@ -11,12 +11,12 @@ CheckBox::CheckBox(QWidget *parent) : QCheckBox(parent), Control(parent)
 }
 
 
-void CheckBox::setSpecificProp(const QString& prop, const QString& value)
+void CheckBox::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         this->setText(value);
 
-    } else if (prop == "State") {
+    } else if (prop == PropId::State) {
         if (value == "Checked") {
             this->setCheckState(Qt::Checked);
         } else {
@@ -27,14 +27,14 @@ void CheckBox::setSpecificProp(const QString& prop, const QString& value)
 }
 
 
-QString CheckBox::getSpecificProp(const QString& prop)
+QString CheckBox::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         value = this->text();
 
-    } else if (prop == "State") {
+    } else if (prop == PropId::State) {
         if (this->checkState() == Qt::Checked) {
             value = "Checked";
         } else {
@@ -49,7 +49,7 @@ QString CheckBox::getSpecificProp(const QString& prop)
 
 void CheckBox::processClick()
 {
-    if (propsDict["Events"].contains("StateChanged")) {
+    if (hasEvent(ControlEvent::StateChanged)) {
         QString state;
 
         if (this->checkState() == Qt::Checked) {
@@ -58,6 +58,6 @@ void CheckBox::processClick()
             state = "Unchecked";
         }
 
-        emit checkBoxEvent(propsDict["Name"], "StateChanged`" + state);
+        emit checkBoxEvent(propSlots[PropId::Name], "StateChanged`" + state);
     }
 }
@@ -14,8 +14,8 @@ class CheckBox : public QCheckBox, public Control
 public:
     explicit CheckBox(QWidget *parent = 0);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 signals:
     void checkBoxEvent(const QString &name, const QString &event);
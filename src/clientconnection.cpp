@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "clientconnection.h"
+#include "requestparser.h"
+#include "binaryrequestcodec.h"
+
+#include <QTcpSocket>
+#include <QLocalSocket>
+
+ClientConnection::ClientConnection(QIODevice *device, bool framed, QObject *parent)
+    : QObject(parent), device(device), framed(framed)
+{
+    device->setParent(this);
+
+    connect(device, &QIODevice::readyRead, this, &ClientConnection::readyRead);
+
+    if (auto *tcpSocket = qobject_cast<QTcpSocket*>(device)) {
+        connect(tcpSocket, &QTcpSocket::disconnected, this, &ClientConnection::disconnected);
+
+    } else if (auto *localSocket = qobject_cast<QLocalSocket*>(device)) {
+        connect(localSocket, &QLocalSocket::disconnected, this, &ClientConnection::disconnected);
+    }
+}
+
+
+void ClientConnection::readyRead()
+{
+    QByteArray receivedBytes = device->readAll();
+
+    if (firstMessage) {
+        if (switchToBinary(receivedBytes)) {
+            send("OK");
+        } else if (firstMessage) {
+            return;  // Too little received to tell yet, or closed on an error
+        }
+    }
+
+    if ( ! framed) {
+        emitMessage(QString::fromUtf8(receivedBytes));
+        return;
+    }
+
+    framer.append(receivedBytes);
+    takeFramedMessages();
+}
+
+
+// Looks for the hello at the start of the first message. It is removed
+// from receivedBytes, anything behind it is the first binary request.
+// Binary requests are always framed, whatever --framing says. Without
+// framing, the hello may come in pieces, so bytes are collected as long
+// as they could still become the hello.
+bool ClientConnection::switchToBinary(QByteArray &receivedBytes)
+{
+    const QByteArray &hello = BinaryRequestCodec::hello();
+
+    if ( ! framed) {
+        unframedStart += receivedBytes;
+        receivedBytes.clear();
+
+        if (unframedStart.size() < hello.size()
+                && hello.startsWith(unframedStart)) {
+            return false;
+        }
+
+        firstMessage = false;
+        receivedBytes.swap(unframedStart);
+
+        if ( ! receivedBytes.startsWith(hello)) {
+            return false;
+        }
+
+        receivedBytes.remove(0, hello.size());
+
+    } else {
+        framer.append(receivedBytes);
+        receivedBytes.clear();
+
+        QByteArray payload;
+        if ( ! framer.takeMessage(payload)) {
+            if (framer.hasError()) {
+                closeOnFrameError();
+            }
+            return false;  // First frame not complete yet
+        }
+
+        firstMessage = false;
+
+        if (payload != hello) {
+            emitMessage(QString::fromUtf8(payload));
+            return false;
+        }
+    }
+
+    framed = true;
+    binary = true;
+    qInfo() << "Binary requests:" << peerName();
+
+    return true;
+}
+
+
+void ClientConnection::takeFramedMessages()
+{
+    QByteArray payload;
+    while (framer.takeMessage(payload)) {
+        if (binary) {
+            QString requestId;
+            QList<Request> requests = BinaryRequestCodec::decode(payload, requestId);
+            emit requestsReceived(requests, requestId);
+        } else {
+            emitMessage(QString::fromUtf8(payload));
+        }
+    }
+
+    if (framer.hasError()) {
+        closeOnFrameError();
+    }
+}
+
+
+void ClientConnection::closeOnFrameError()
+{
+    qWarning() << "Invalid frame header, closing connection.";
+
+    // disconnectFromClient() unhooks the socket, so its disconnected
+    // signal never arrives: the owner is told here instead
+    emit disconnected();
+    disconnectFromClient();
+}
+
+
+void ClientConnection::emitMessage(QString message)
+{
+    QString requestId = RequestParser::takeRequestId(message);
+
+    // Stray line breaks between requests are no request of their own
+    if (requestId.isEmpty() && message.trimmed().isEmpty()) {
+        return;
+    }
+
+    emit messageReceived(message, requestId);
+}
+
+
+void ClientConnection::send(const QString &message)
+{
+    if (framed) {
+        device->write(MessageFramer::frame(message.toUtf8()));
+    } else {
+        device->write(message.toUtf8());
+    }
+
+    if (auto *tcpSocket = qobject_cast<QTcpSocket*>(device)) {
+        tcpSocket->flush();
+
+    } else if (auto *localSocket = qobject_cast<QLocalSocket*>(device)) {
+        localSocket->flush();
+    }
+}
+
+
+void ClientConnection::disconnectFromClient(int waitMsecs)
+{
+    disconnect(device, nullptr, this, nullptr);
+
+    if (auto *tcpSocket = qobject_cast<QTcpSocket*>(device)) {
+        tcpSocket->disconnectFromHost();
+
+        if (waitMsecs > 0 && tcpSocket->state() != QAbstractSocket::UnconnectedState) {
+            tcpSocket->waitForDisconnected(waitMsecs);
+        }
+
+    } else if (auto *localSocket = qobject_cast<QLocalSocket*>(device)) {
+        localSocket->disconnectFromServer();
+
+        if (waitMsecs > 0 && localSocket->state() != QLocalSocket::UnconnectedState) {
+            localSocket->waitForDisconnected(waitMsecs);
+        }
+    }
+
+    deleteLater();
+}
+
+
+QString ClientConnection::peerName() const
+{
+    if (auto *tcpSocket = qobject_cast<QTcpSocket*>(device)) {
+        return tcpSocket->peerAddress().toString();
+    }
+
+    if (auto *localSocket = qobject_cast<QLocalSocket*>(device)) {
+        return localSocket->serverName();
+    }
+
+    return QString();
+}
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef CLIENTCONNECTION_H
+#define CLIENTCONNECTION_H
+
+#include <QObject>
+#include <QIODevice>
+#include <QPointer>
+
+#include "messageframer.h"
+#include "request.h"
+
+// One connected client, independent of the transport (QTcpSocket or
+// QLocalSocket). Splits the received bytes into messages (framed or not),
+// removes the optional request ID and writes replies back.
+// A client may switch to binary requests by sending the hello of
+// BinaryRequestCodec as its very first message.
+class ClientConnection : public QObject
+{
+    Q_OBJECT
+public:
+    ClientConnection(QIODevice *device, bool framed, QObject *parent = nullptr);
+
+    void send(const QString &message);
+    void disconnectFromClient(int waitMsecs = 0);
+    QString peerName() const;
+
+signals:
+    void messageReceived(const QString &message, const QString &requestId);
+    void requestsReceived(const QList<Request> &requests, const QString &requestId);
+    void disconnected();    // Also if the connection closes itself on an error
+
+private slots:
+    void readyRead();
+
+private:
+    bool switchToBinary(QByteArray &receivedBytes);
+    void takeFramedMessages();
+    void closeOnFrameError();
+    void emitMessage(QString message);
+
+    QIODevice *device;
+    MessageFramer framer;
+    bool framed;
+    bool binary = false;
+    bool firstMessage = true;
+    QByteArray unframedStart;  // Start of an unframed first message
+};
+
+// Replies are prepared in the order of the requests, no matter which
+// client sent them. Every request remembers where its reply goes to.
+struct PendingReply {
+    QPointer<ClientConnection> client;
+    QString requestId;
+};
+
+#endif // CLIENTCONNECTION_H
@@ -12,159 +12,220 @@ Control::Control(QObject* parent)
 
 
 void Control::setProp(const QString &prop, const QString &value)
+{
+    setProp(propIdFromName(prop), value);
+}
+
+
+void Control::setProp(PropId prop, const QString &value)
 {
     // Expand for new props
-    if (   (prop == "Type")
-        || (prop == "Name")
-        || (prop == "Events")
-        || (prop == "MultiLine")
-        || (prop == "Category")
-        || (prop == "Extensions")
-        || (prop == "Suggestion")
-        || (prop == "Path")
-        || (prop == "EntirePaths")
-        || (prop == "DragStyle")
-        ) {
-
-        propsDict[prop] = value;
+    switch (prop) {
+    case PropId::Type:
+    case PropId::Name:
+    case PropId::Events:
+    case PropId::MultiLine:
+    case PropId::Category:
+    case PropId::Extensions:
+    case PropId::Suggestion:
+    case PropId::Path:
+    case PropId::EntirePaths:
+    case PropId::DragStyle:
+        propSlots[prop] = value;
+
+        if (prop == PropId::Events) {
+            subscribedEvents = parseControlEvents(value);
+        }
 
         // One exception: A timer needs to become immediately active
-        if (propsDict["Type"] == "Window" && prop == "Events") {
+        if (prop == PropId::Events && propSlots[PropId::Type] == "Window") {
             setSpecificProp(prop, value);
         }
 
-    } else if (    (prop == "Text")
-                || (prop == "MultiSelect")
-                || (prop == "EntireTexts")
-                || (prop == "Icon")
-                || (prop == "Image")
-                || (prop == "Scaling")
-                || (prop == "Opacity")
-                || (prop == "Offsets")
-                || (prop == "State")
-                || (prop == "QuitNow")
-                || (prop == "Clipboard")
-                || (prop == "Selected")
-                || (prop == "Value")
-                || (prop == "Min")
-                || (prop == "Max")
-                || (prop == "Orientation")
-                || (prop == "AboutHeading")
-                || (prop == "MessageBoxNow")
-                ) {
-
+        break;
+
+    case PropId::Text:
+    case PropId::MultiSelect:
+    case PropId::EntireTexts:
+    case PropId::Icon:
+    case PropId::Image:
+    case PropId::Scaling:
+    case PropId::Opacity:
+    case PropId::Offsets:
+    case PropId::State:
+    case PropId::QuitNow:
+    case PropId::Clipboard:
+    case PropId::Selected:
+    case PropId::Value:
+    case PropId::Min:
+    case PropId::Max:
+    case PropId::Orientation:
+    case PropId::MaxEventRate:
+    case PropId::EventQueueLimit:
+    case PropId::EventChunkSize:
+    case PropId::AboutHeading:
+    case PropId::MessageBoxNow:
+    case PropId::AppendTexts:   // Write-only, nothing to get
+    case PropId::InsertTexts:
+    case PropId::RemoveRows:
+    case PropId::ReplaceTexts:
         setSpecificProp(prop, value);
 
-    } else {
-        // Apply more general property to Widget -----
-        auto widget = dynamic_cast<QWidget*>(this);
+        break;
 
-        if (prop == "Style") {
-            propsDict[prop] = value;
-            widget->setStyleSheet(value);
+    // Apply more general property to Widget -----
+    case PropId::Style:
+        propSlots[PropId::Style] = value;
+        dynamic_cast<QWidget*>(this)->setStyleSheet(value);
 
-        } else if (prop == "ToolTip") {
-            widget->setToolTip(value);
+        break;
 
-        } else if (prop == "Show") {     // Different at getProp
-            propsDict[prop] = value;
+    case PropId::ToolTip:
+        dynamic_cast<QWidget*>(this)->setToolTip(value);
 
-            if (controlMightGetInactive) {
-                if (value == "Normal") {
-                    widget->show();
-                    widget->setEnabled(true);
+        break;
 
-                } else if (value == "Disabled") {
-                    widget->show();
-                    widget->setEnabled(false);
+    case PropId::Show: {    // Different at getProp
+        auto widget = dynamic_cast<QWidget*>(this);
+        propSlots[PropId::Show] = value;
 
-                } else if (value == "Invisible") {
-                    widget->hide();
+        if (controlMightGetInactive) {
+            if (value == "Normal") {
+                widget->show();
+                widget->setEnabled(true);
+
+            } else if (value == "Disabled") {
+                widget->show();
+                widget->setEnabled(false);
+
+            } else if (value == "Invisible") {
+                widget->hide();
 
-                }
             }
+        }
+
+        break;
+    }
 
-        } else if (prop == "Geometry") {
-            QStringList data = value.split(",");
+    case PropId::Geometry: {
+        auto widget = dynamic_cast<QWidget*>(this);
+        QStringList data = value.split(",");
 
-            widget->setGeometry(data[0].toInt(), data[1].toInt(), data[2].toInt(), data[3].toInt());
-            widget->show();
+        widget->setGeometry(data[0].toInt(), data[1].toInt(), data[2].toInt(), data[3].toInt());
+        widget->show();
 
-        }
+        break;
+    }
+
+    default:
+        break;
     }
 }
 
 
 QString Control::getProp(const QString &prop)
+{
+    return getProp(propIdFromName(prop));
+}
+
+
+QString Control::getProp(PropId prop)
 {
     QString value = "";
-    // Expand for new props
-    if (   (prop == "Type")
-        || (prop == "Name")
-        || (prop == "Events")
-        || (prop == "Show")      // Different at setProp
-        || (prop == "MultiLine")
-        || (prop == "Category")
-        || (prop == "Extensions")
-        || (prop == "Suggestion")
-        || (prop == "Path")
-        || (prop == "EntirePaths")
-        || (prop == "DragStyle")
-        ) {
-
-        value = propsDict[prop];
-
-    } else if (    (prop == "Text")
-                || (prop == "MultiSelect")
-                || (prop == "EntireTexts")
-                || (prop == "Icon")
-                || (prop == "Image")
-                || (prop == "Scaling")
-                || (prop == "Opacity")
-                || (prop == "Offsets")
-                || (prop == "Dimensions")  // Read-Only, no setProp
-                || (prop == "State")
-                || (prop == "QuitNow")
-                || (prop == "Clipboard")
-                || (prop == "Selected")
-                || (prop == "Value")
-                || (prop == "Min")
-                || (prop == "Max")
-                || (prop == "Orientation")
-                || (prop == "AboutHeading")
-                || (prop == "MessageBoxNow")
-                ) {
 
+    // Expand for new props
+    switch (prop) {
+    case PropId::Type:
+    case PropId::Name:
+    case PropId::Events:
+    case PropId::Show:      // Different at setProp
+    case PropId::MultiLine:
+    case PropId::Category:
+    case PropId::Extensions:
+    case PropId::Suggestion:
+    case PropId::Path:
+    case PropId::EntirePaths:
+    case PropId::DragStyle:
+        value = propSlots[prop];
+
+        break;
+
+    case PropId::Text:
+    case PropId::MultiSelect:
+    case PropId::EntireTexts:
+    case PropId::Icon:
+    case PropId::Image:
+    case PropId::Scaling:
+    case PropId::Opacity:
+    case PropId::Offsets:
+    case PropId::Dimensions:  // Read-Only, no setProp
+    case PropId::ItemCount:   // Read-Only, no setProp
+    case PropId::State:
+    case PropId::QuitNow:
+    case PropId::Clipboard:
+    case PropId::Selected:
+    case PropId::Value:
+    case PropId::Min:
+    case PropId::Max:
+    case PropId::Orientation:
+    case PropId::MaxEventRate:
+    case PropId::EventQueueLimit:
+    case PropId::EventChunkSize:
+    case PropId::AboutHeading:
+    case PropId::MessageBoxNow:
         value = getSpecificProp(prop);
 
-    } else {
-        // Get more general property from Widget -----
-        auto widget = dynamic_cast<QWidget*>(this);
+        break;
 
-        if (prop == "Style") {
-            value = widget->styleSheet();
+    // Get more general property from Widget -----
+    case PropId::Style:
+        value = dynamic_cast<QWidget*>(this)->styleSheet();
 
-        } else if (prop == "ToolTip") {
-            value = widget->toolTip();
+        break;
 
-        } else if (prop == "Geometry") {
-            int data[4];
+    case PropId::ToolTip:
+        value = dynamic_cast<QWidget*>(this)->toolTip();
 
-            widget->geometry().getRect(&data[0], &data[1], &data[2], &data[3]);
+        break;
 
-            value = QString::number(data[0]) + "," + QString::number(data[1]) + "," +
-                    QString::number(data[2]) + "," + QString::number(data[3]);
-        }
+    case PropId::Geometry: {
+        int data[4];
+
+        dynamic_cast<QWidget*>(this)->geometry().getRect(&data[0], &data[1], &data[2], &data[3]);
+
+        value = QString::number(data[0]) + "," + QString::number(data[1]) + "," +
+                QString::number(data[2]) + "," + QString::number(data[3]);
+
+        break;
+    }
+
+    default:
+        break;
     }
 
     return value;
 }
 
 
+// get`Name`Prop`offset,length`: a page of a big value. Entire properties
+// are paged by rows, all others by characters. Controls that hold a big
+// value in a better form override this.
+QString Control::getPropRange(PropId prop, int offset, int length)
+{
+    QString value = getProp(prop);
+
+    if (propNameOf(prop).startsWith("Entire")) {
+        return sliceRows(value, offset, length);
+    }
+
+    return value.mid(offset, length);
+}
+
+
 QList<PropInfo> Control::getAllPropInfos() {
     const auto& prototypes = getPrototypes();
 
-    auto protoProps = prototypes.find(getProp("Type"));
+    auto protoProps = prototypes.find(getProp(PropId::Type));
     if (protoProps != prototypes.end()) {
         return protoProps.value();
     }
@@ -204,6 +265,63 @@ int Control::applyDefaultProperties(int typeCount, int yPos)
 }
 
 
+// InsertTexts and ReplaceTexts: the row comes first, then the items,
+// e.g. "3`a`b". Returns false if the row is no number.
+bool Control::splitRowAndTexts(const QString &value, int &row, QString &texts)
+{
+    qsizetype separator = value.indexOf('`');
+    bool conversionOk;
+
+    if (separator < 0) {
+        row = value.toInt(&conversionOk);
+        texts.clear();
+    } else {
+        row = QStringView(value).left(separator).toInt(&conversionOk);
+        texts = value.mid(separator + 1);
+    }
+
+    return conversionOk;
+}
+
+
+// Rows row ... row+count-1 of a backtick-separated list, less at its end.
+// Past the end the result is empty, the same as for a single empty row.
+QString Control::sliceRows(const QString &entireValue, int row, int count)
+{
+    qsizetype start = 0;
+
+    for (int idxRow = 0; idxRow < row; idxRow++) {
+        start = entireValue.indexOf('`', start);
+        if (start < 0) {
+            return QString();
+        }
+        start++;
+    }
+
+    if (count <= 0 || entireValue.isEmpty()) {
+        return QString();
+    }
+
+    qsizetype end = start - 1;
+
+    for (int idxRow = 0; idxRow < count; idxRow++) {
+        end = entireValue.indexOf('`', end + 1);
+        if (end < 0) {
+            end = entireValue.size();
+            break;
+        }
+    }
+
+    return entireValue.mid(start, end - start);
+}
+
+
+bool Control::hasEvent(ControlEvent event) const
+{
+    return subscribedEvents.testFlag(event);
+}
+
+
 int Control::getId() const
 {
     return id;
@@ -8,6 +8,8 @@
 #include <QStringList>
 #include <QWidget>
 #include "controlprototypes.h"
+#include "propid.h"
+#include "controlevents.h"
 
 class Control
 {
@@ -18,6 +20,14 @@ public:
 
     virtual QString getProp(const QString& prop);
     virtual void setProp(const QString& prop, const QString& value);
+    QString getProp(PropId prop);
+    void setProp(PropId prop, const QString& value);
+    virtual QString getPropRange(PropId prop, int offset, int length);
+
+    bool hasEvent(ControlEvent event) const;
+
+    static bool splitRowAndTexts(const QString &value, int &row, QString &texts);
+    static QString sliceRows(const QString &entireValue, int row, int count);
 
     int getId() const;
     void setId(int newId);
@@ -30,15 +40,16 @@ public:
 
 protected:
     int id;
-    QMap<QString, QString> propsDict;
+    PropSlots propSlots;
+    ControlEvents subscribedEvents;
 
 private:
     QObject* dynParent;
 
     bool controlMightGetInactive = true;
 
-    virtual void setSpecificProp(const QString& prop, const QString& value) = 0;
-    virtual QString getSpecificProp(const QString& prop) = 0;
+    virtual void setSpecificProp(PropId prop, const QString& value) = 0;
+    virtual QString getSpecificProp(PropId prop) = 0;
 
 };
 
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "controlevents.h"
+
+#include <QHash>
+
+// Whole names only: "DoubleClicked" does not subscribe to "Clicked"
+ControlEvents parseControlEvents(const QString &events)
+{
+    static const QHash<QString, ControlEvent> eventByName = {
+        {"Clicked", ControlEvent::Clicked},
+        {"DoubleClicked", ControlEvent::DoubleClicked},
+        {"SelectionChanged", ControlEvent::SelectionChanged},
+        {"ReturnPressed", ControlEvent::ReturnPressed},
+        {"StateChanged", ControlEvent::StateChanged},
+        {"Dropped", ControlEvent::Dropped},
+        {"ClickedAtPos", ControlEvent::ClickedAtPos},
+        {"Chosen", ControlEvent::Chosen},
+        {"Moved", ControlEvent::Moved},
+        {"Pressed", ControlEvent::Pressed},
+        {"Released", ControlEvent::Released},
+        {"ClipboardChanged", ControlEvent::ClipboardChanged},
+        {"Closed", ControlEvent::Closed},
+        {"Resized", ControlEvent::Resized},
+        {"KeyPressed", ControlEvent::KeyPressed},
+        {"ImageLoaded", ControlEvent::ImageLoaded},
+    };
+
+    ControlEvents result;
+
+    const QList<QStringView> names = QStringView(events).split(u',');
+
+    for (QStringView name : names) {
+        auto found = eventByName.constFind(name.trimmed().toString());
+        if (found != eventByName.constEnd()) {
+            result |= found.value();
+        }
+    }
+
+    return result;
+}
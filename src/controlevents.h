@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef CONTROLEVENTS_H
+#define CONTROLEVENTS_H
+
+#include <QFlags>
+#include <QString>
+
+// The events a control can be subscribed to. The Events property is parsed
+// into these flags once when it is set, so an event handler only has to
+// test a bit instead of searching the property text.
+//
+// Expand for new events
+enum class ControlEvent : quint32 {
+    Clicked          = 1u << 0,
+    DoubleClicked    = 1u << 1,
+    SelectionChanged = 1u << 2,
+    ReturnPressed    = 1u << 3,
+    StateChanged     = 1u << 4,
+    Dropped          = 1u << 5,
+    ClickedAtPos     = 1u << 6,
+    Chosen           = 1u << 7,
+    Moved            = 1u << 8,
+    Pressed          = 1u << 9,
+    Released         = 1u << 10,
+    ClipboardChanged = 1u << 11,
+    Closed           = 1u << 12,
+    Resized          = 1u << 13,
+    KeyPressed       = 1u << 14,
+    ImageLoaded      = 1u << 15
+};
+
+Q_DECLARE_FLAGS(ControlEvents, ControlEvent)
+Q_DECLARE_OPERATORS_FOR_FLAGS(ControlEvents)
+
+ControlEvents parseControlEvents(const QString &events);
+
+#endif // CONTROLEVENTS_H
@@ -32,6 +32,10 @@ const Prototypes &getPrototypes()
                     "Opens a message box with the given text; always read as ''"},
                 {"QuitNow", "False", "S", "Single:True,False",
                     "Immediately quits the GUI if True"},
+                {"EventQueueLimit", "10000", "SW", "Int:P",
+                    "Max. number of queued events (at least 1), the oldest are dropped beyond"},
+                {"EventChunkSize", "0", "SW", "Int:U",
+                    "Max. number of events per events? reply (0 = all)"},
                 {"Icon", "", "SW", "",
                     "Path to an icon for the GUI window"},
                 {"Style", "", "SW", "",
@@ -86,6 +90,16 @@ const Prototypes &getPrototypes()
                     "Events that can trigger notifications"},
                 {"EntireTexts", "", "SW", "",
                     "All list entries"},
+                {"AppendTexts", "", "S", "",
+                    "Entries to add at the end of the list"},
+                {"InsertTexts", "", "S", "ListInsert",
+                    "Row, then the entries to insert before it"},
+                {"RemoveRows", "", "S", "ListRemove",
+                    "First row, number of rows to remove"},
+                {"ReplaceTexts", "", "S", "ListReplace",
+                    "Row, then the entries that replace it and the following"},
+                {"ItemCount", "", "", "",
+                    "Number of list entries, tells where paging EntireTexts ends"},
                 {"MultiSelect", "False", "SW", "Single:True,False",
                     "Multiple selection enabled"},
                 {"Selected", "", "SW", "IndecesInRange",
@@ -176,7 +190,7 @@ const Prototypes &getPrototypes()
                     "Control type"},
                 {"Geometry", "10,#YPOS#,100,100", "SW", "Int:U,U,U,U",
                     "Left, top, width, height"},
-                {"Events", "", "SW", "Multi:ClickedAtPos",
+                {"Events", "", "SW", "Multi:ClickedAtPos,ImageLoaded",
                     "Events that can trigger notifications"},
                 {"Image", ":/PixelRuler.png", "SW", "",
                     "Path to the image file"},
@@ -248,6 +262,16 @@ const Prototypes &getPrototypes()
                     "Events that can trigger notifications"},
                 {"EntireTexts", "", "SW", "",
                     "All list entries"},
+                {"AppendTexts", "", "S", "",
+                    "Entries to add at the end of the list"},
+                {"InsertTexts", "", "S", "ListInsert",
+                    "Row, then the entries to insert before it"},
+                {"RemoveRows", "", "S", "ListRemove",
+                    "First row, number of rows to remove"},
+                {"ReplaceTexts", "", "S", "ListReplace",
+                    "Row, then the entries that replace it and the following"},
+                {"ItemCount", "", "", "",
+                    "Number of list entries, tells where paging EntireTexts ends"},
                 {"Selected", "1", "SW", "IndecesInRange",
                     "Index of currently selected item"},
                 {"Style", "", "SW", "",
@@ -274,6 +298,8 @@ const Prototypes &getPrototypes()
                     "Maximum selectable value"},
                 {"Orientation", "Horizontal", "SW", "Single:Horizontal,Vertical",
                     "Orientation of the slider"},
+                {"MaxEventRate", "0", "SW", "Int:U",
+                    "Max. Moved events per second, the last one is never lost (0 = unlimited)"},
                 {"Style", "", "SW", "",
                     "CSS-style appearance using Qt setStyleSheet"},
                 {"Show", "Normal", "SW", "Single:Normal,Disabled,Invisible,ToBeDeleted",
@@ -12,19 +12,19 @@ DropArea::DropArea(QWidget *parent) : QLabel(parent)
 }
 
 
-void DropArea::setSpecificProp(const QString& prop, const QString& value)
+void DropArea::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         this->setText(value);
     }
 }
 
 
-QString DropArea::getSpecificProp(const QString& prop)
+QString DropArea::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         value = this->text();
     }
 
@@ -49,26 +49,26 @@ void DropArea::dropEvent(QDropEvent *event)
         strUrls = list.join("`");
     }
 
-    propsDict["EntirePaths"] = strUrls;
+    propSlots[PropId::EntirePaths] = strUrls;
 
-    if (propsDict["Events"].contains("Dropped")) {
-        emit dropAreaEvent(propsDict["Name"], "Dropped`" + strUrls);
+    if (hasEvent(ControlEvent::Dropped)) {
+        emit dropAreaEvent(propSlots[PropId::Name], "Dropped`" + strUrls);
     }
 
-    this->setStyleSheet(propsDict["Style"]);
+    this->setStyleSheet(propSlots[PropId::Style]);
     event->acceptProposedAction();
 }
 
 
 void DropArea::dragEnterEvent(QDragEnterEvent *event)
 {
-    this->setStyleSheet(propsDict["DragStyle"]);
+    this->setStyleSheet(propSlots[PropId::DragStyle]);
     event->accept();
 }
 
 
 void DropArea::dragLeaveEvent(QDragLeaveEvent *event)
 {
-    this->setStyleSheet(propsDict["Style"]);
+    this->setStyleSheet(propSlots[PropId::Style]);
 }
 
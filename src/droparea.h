@@ -14,8 +14,8 @@ class DropArea : public QLabel, public Control
 public:
     DropArea(QWidget *parent = nullptr);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 signals:
     void dropAreaEvent(const QString &name, const QString &event);
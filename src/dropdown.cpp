@@ -5,6 +5,7 @@
 
 #include "QStringList"
 #include "QString"
+#include "QSignalBlocker"
 
 DropDown::DropDown(QWidget *parent) : QComboBox(parent), Control(parent)
 {
@@ -12,15 +13,53 @@ DropDown::DropDown(QWidget *parent) : QComboBox(parent), Control(parent)
 }
 
 
-void DropDown::setSpecificProp(const QString& prop, const QString& value)
+void DropDown::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "EntireTexts") {
+    if (prop == PropId::EntireTexts) {
         this->clear();
-        QStringList items = value.split("`");
 
-        this->addItems(items);
+        // Like in ListBox, an empty value means no items at all
+        if ( ! value.isEmpty()) {
+            this->addItems(value.split("`"));
+        }
+
+    } else if (prop == PropId::AppendTexts) {
+        // Editing rows can move the current index. That is no selection
+        // by the user, so it must not end up as SelectionChanged.
+        const QSignalBlocker blocker(this);
+
+        if ( ! value.isEmpty()) {
+            this->addItems(value.split("`"));
+        }
+
+    } else if (prop == PropId::InsertTexts || prop == PropId::ReplaceTexts) {
+        const QSignalBlocker blocker(this);
+        int row;
+        QString texts;
+
+        if (splitRowAndTexts(value, row, texts) && ! texts.isEmpty()) {
+            QStringList items = texts.split("`");
+
+            if (prop == PropId::InsertTexts) {
+                this->insertItems(row, items);
+            } else {
+                for (int idxItem = 0; idxItem < items.size(); idxItem++) {
+                    this->setItemText(row + idxItem, items[idxItem]);
+                }
+            }
+        }
+
+    } else if (prop == PropId::RemoveRows) {
+        const QSignalBlocker blocker(this);
+        int row = value.section(',', 0, 0).toInt();
+        int count = value.section(',', 1, 1).toInt();
 
-    } else if (prop == "Selected") {
+        // Backwards, so the rows in front keep their index
+        for (int idxRow = row + count - 1; idxRow >= row; idxRow--) {
+            this->removeItem(idxRow);
+        }
+
+    } else if (prop == PropId::Selected) {
         int selectedIndex = 0;
 
         if (value.trimmed().isEmpty()) {
@@ -34,11 +73,11 @@ void DropDown::setSpecificProp(const QString& prop, const QString& value)
 }
 
 
-QString DropDown::getSpecificProp(const QString& prop)
+QString DropDown::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "EntireTexts") {
+    if (prop == PropId::EntireTexts) {
         for (int row = 0; row < this->count(); row++) {
             value = value + this->itemText(row) + "`";
         }
@@ -46,13 +85,16 @@ QString DropDown::getSpecificProp(const QString& prop)
             value.chop(1);
         }
 
-    } else if (prop == "Selected") {
+    } else if (prop == PropId::Selected) {
         value = QString::number(this->currentIndex());
 
         if (value == "-1") {
             value = "";
         }
 
+    } else if (prop == PropId::ItemCount) {
+        value = QString::number(this->count());
+
     }
 
     return value;
@@ -61,8 +103,8 @@ QString DropDown::getSpecificProp(const QString& prop)
 
 void DropDown::processSelectionChange()
 {
-    if (propsDict["Events"].contains("SelectionChanged")) {
-        emit dropDownEvent(propsDict["Name"], "SelectionChanged`" + QString::number(this->currentIndex()));
+    if (hasEvent(ControlEvent::SelectionChanged)) {
+        emit dropDownEvent(propSlots[PropId::Name], "SelectionChanged`" + QString::number(this->currentIndex()));
     }
 }
 
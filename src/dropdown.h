@@ -14,8 +14,8 @@ class DropDown : public QComboBox, public Control
 public:
     explicit DropDown(QWidget *parent = nullptr);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 signals:
     void dropDownEvent(const QString &name, const QString &event);
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "eventqueue.h"
+
+// Expand for new events with state-like data
+bool EventQueue::isCoalescable(QStringView eventType)
+{
+    return eventType == u"Moved"
+        || eventType == u"Resized"
+        || eventType == u"SelectionChanged";
+}
+
+
+void EventQueue::append(const QString &name, const QString &event)
+{
+    QString line = name + "`" + event + "`\n";
+    qint64 nextSeq = headSeq + size();
+
+    QStringView eventType = QStringView(event).left(event.indexOf('`'));
+
+    if (isCoalescable(eventType)) {
+        QString key = name + "`" + eventType.toString();
+
+        auto found = coalescableSeqByKey.constFind(key);
+        if (found != coalescableSeqByKey.constEnd()
+            && found.value() >= headSeq
+            && lastSeqByName.value(name, -1) == found.value()) {
+
+            lines[headPos + (found.value() - headSeq)] = line;
+            return;
+        }
+
+        coalescableSeqByKey.insert(key, nextSeq);
+    }
+
+    if (size() >= maxSize) {
+        dropOldest();
+    }
+
+    lastSeqByName.insert(name, nextSeq);
+    lines.append(line);
+}
+
+
+// Takes the oldest events, at most maxEvents of them (0 = all)
+QString EventQueue::take(int maxEvents)
+{
+    int count = size();
+    if (maxEvents > 0 && maxEvents < count) {
+        count = maxEvents;
+    }
+
+    QString result;
+    for (qsizetype idx = headPos; idx < headPos + count; idx++) {
+        result += lines[idx];
+    }
+
+    if (count == size()) {
+        // Empty again: start over, so the hashes do not grow forever
+        lines.clear();
+        headPos = 0;
+        headSeq = 0;
+        coalescableSeqByKey.clear();
+        lastSeqByName.clear();
+
+    } else {
+        for (qsizetype idx = headPos; idx < headPos + count; idx++) {
+            lines[idx].clear();
+        }
+        headPos += count;
+        headSeq += count;
+        compact();
+    }
+
+    return result;
+}
+
+
+int EventQueue::takeDroppedCount()
+{
+    int count = droppedCount;
+    droppedCount = 0;
+
+    return count;
+}
+
+
+void EventQueue::setCapacity(int newCapacity)
+{
+    maxSize = qMax(1, newCapacity);
+
+    while (size() > maxSize) {
+        dropOldest();
+    }
+}
+
+
+int EventQueue::capacity() const
+{
+    return maxSize;
+}
+
+
+bool EventQueue::isEmpty() const
+{
+    return size() == 0;
+}
+
+
+int EventQueue::size() const
+{
+    return int(lines.size() - headPos);
+}
+
+
+void EventQueue::dropOldest()
+{
+    lines[headPos].clear();
+    headPos++;
+    headSeq++;
+    droppedCount++;
+
+    compact();
+}
+
+
+// Removing from the front of a QList is expensive, so it is done only
+// when the unused part has become large
+void EventQueue::compact()
+{
+    if (headPos > 1024 && headPos > lines.size() / 2) {
+        lines.remove(0, headPos);
+        headPos = 0;
+    }
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+
+// Events waiting for the next events? request. Events that describe a
+// state (Moved, Resized, SelectionChanged) are coalesced: while an older
+// one of the same control is still the latest queued event of that
+// control, it is overwritten with the new data. So a drag that produces
+// thousands of mouse moves leaves one event in the queue, and the order
+// of the events of each control is kept.
+//
+// The queue is bounded: if a client stops asking, the oldest events are
+// dropped and counted, so the memory of the GUI does not grow forever.
+class EventQueue
+{
+public:
+    static constexpr int defaultCapacity = 10000;
+
+    void append(const QString &name, const QString &event);
+    QString take(int maxEvents = 0);
+    int takeDroppedCount();
+
+    void setCapacity(int newCapacity);
+    int capacity() const;
+
+    bool isEmpty() const;
+    int size() const;
+
+    static bool isCoalescable(QStringView eventType);
+
+private:
+    void dropOldest();
+    void compact();
+
+    // Queued events are lines[headPos] ... lines.last(). The hashes hold
+    // sequence numbers, which stay valid when the head moves.
+    QList<QString> lines;
+    qsizetype headPos = 0;
+    qint64 headSeq = 0;
+
+    QHash<QString, qint64> coalescableSeqByKey;
+    QHash<QString, qint64> lastSeqByName;
+
+    int maxSize = defaultCapacity;
+    int droppedCount = 0;
+};
+
+#endif // EVENTQUEUE_H
@@ -8,7 +8,7 @@
 #include <QThread>
 
 FileBasedServer::FileBasedServer(const AppConfig &config, QObject *parent)
-    : QObject(parent)
+    : QObject(parent), watcher(this), pollTimer(this), eventTimer(this)
 {
     exchangeDir = config.exchangeDir;
     Q_ASSERT(exchangeDir.exists());
@@ -16,11 +16,20 @@ FileBasedServer::FileBasedServer(const AppConfig &config, QObject *parent)
     pollTimer.setInterval(100);
 
     connect(&pollTimer, &QTimer::timeout, this, &FileBasedServer::pollForRequestFileOrEvents);
+    connect(&watcher, &QFileSystemWatcher::directoryChanged, this, &FileBasedServer::pollForRequestFileOrEvents);
 }
 
 
 void FileBasedServer::start()
 {
+    // The watcher reacts on the rename of the request file at once and events
+    // are written as they occur. Timer only as safety net, e.g. network drives
+    if (watcher.addPath(exchangeDir.absolutePath())) {
+        eventsPushed = true;
+        pollTimer.setInterval(1000);
+        emit eventSubscriptionChanged(true);
+    }
+
     pollTimer.start();
     qInfo() << "FileBasedServer running in" << exchangeDir.absolutePath();
 }
@@ -29,37 +38,66 @@ void FileBasedServer::start()
 void FileBasedServer::quit()
 {
     pollTimer.stop();
+    watcher.removePaths(watcher.directories());
 }
 
 
 void FileBasedServer::pollForRequestFileOrEvents()
 {
+    treatNumberedRequestFiles();
+
     // the poll is time triggered: has every request already be been replied?
     if ( ! (replyCount == requestCount)) {
         return;
     }
 
-    if (pollEventsNext == true) {
+    // Without pushed events, every other poll asks for the events itself.
+    // An empty reply file name stands for "reply goes to an events file"
+    if (pollEventsNext == true && ! eventsPushed) {
         pollEventsNext = false;
 
         requestCount++;
+        pendingReplyFiles.enqueue("");
         emit messageFromClientReceived("events?", true);
 
     } else {
         pollEventsNext = true;
 
         QString payload;
-        if (readAndDeleteRequestFile(payload)) {
+        if (readAndDeleteRequestFile("request.txt", payload)) {
             requestCount++;
+            pendingReplyFiles.enqueue("reply.txt");
             emit messageFromClientReceived(payload, true);
         }
     }
 }
 
 
-bool FileBasedServer::readAndDeleteRequestFile(QString& payloadOut)
+void FileBasedServer::treatNumberedRequestFiles()
+{
+    // Like the event files: 000000000001_request.txt, 000000000002_request.txt ...
+    // All present files are treated in order, each gets its own numbered reply
+    const QStringList fileNames = exchangeDir.entryList({"*_request.txt"}, QDir::Files, QDir::Name);
+
+    for (const QString &fileName : fileNames) {
+        QString payload;
+        if ( ! readAndDeleteRequestFile(fileName, payload)) {
+            break;
+        }
+
+        QString replyFileName = fileName;
+        replyFileName.replace("_request.txt", "_reply.txt");
+
+        requestCount++;
+        pendingReplyFiles.enqueue(replyFileName);
+        emit messageFromClientReceived(payload, true);
+    }
+}
+
+
+bool FileBasedServer::readAndDeleteRequestFile(const QString &fileName, QString& payloadOut)
 {
-    const QString requestPath = exchangeDir.filePath("request.txt");
+    const QString requestPath = exchangeDir.filePath(fileName);
     QFileInfo requestInfo(requestPath);
 
     if ( ! requestInfo.exists()) {
@@ -81,21 +119,38 @@ bool FileBasedServer::readAndDeleteRequestFile(QString& payloadOut)
 
 void FileBasedServer::sendReplyToClient(const QString &message)
 {
-    if (pollEventsNext == false) {
+    QString replyFileName = "reply.txt";
+    if ( ! pendingReplyFiles.isEmpty()) {
+        replyFileName = pendingReplyFiles.dequeue();
+    }
+
+    if (replyFileName.isEmpty()) {
         if ( ! (message == "NONE")) {
-            nextEventFileIndex++;
-            const QString fileName = QString("%1_events.txt").arg(nextEventFileIndex, 12, 10, QLatin1Char('0'));
-            writeFile(message, fileName);
+            writeEventFile(message);
         }
 
     } else {
-        writeFile(message, "reply.txt");
+        writeFile(message, replyFileName);
     }
 
     replyCount++;
 }
 
 
+void FileBasedServer::pushEventsToClient(const QString &events)
+{
+    writeEventFile(events);
+}
+
+
+void FileBasedServer::writeEventFile(const QString &events)
+{
+    nextEventFileIndex++;
+    const QString fileName = QString("%1_events.txt").arg(nextEventFileIndex, 12, 10, QLatin1Char('0'));
+    writeFile(events, fileName);
+}
+
+
 void FileBasedServer::writeFile(const QString &message, const QString &fileName)
 {
     const QString path = exchangeDir.filePath(fileName);
@@ -8,6 +8,8 @@
 #include <QObject>
 #include <QTimer>
 #include <QDir>
+#include <QFileSystemWatcher>
+#include <QQueue>
 
 class FileBasedServer : public QObject
 {
@@ -19,21 +21,28 @@ public slots:
     void start();
     void quit();
     void sendReplyToClient(const QString &message);
+    void pushEventsToClient(const QString &events);
 
 signals:
     void messageFromClientReceived(const QString &message, bool replyExpected);
+    void eventSubscriptionChanged(bool subscribed);
 
 private slots:
     void pollForRequestFileOrEvents();
 
 private:
     void writeFile(const QString &payloadUtf8, const QString &fileName);
-    bool readAndDeleteRequestFile(QString &payloadOut);
+    void writeEventFile(const QString &events);
+    bool readAndDeleteRequestFile(const QString &fileName, QString &payloadOut);
+    void treatNumberedRequestFiles();
 
     bool pollEventsNext = true;
+    bool eventsPushed = false;
     QDir exchangeDir;
+    QFileSystemWatcher watcher;
     QTimer pollTimer;
     QTimer eventTimer;
+    QQueue<QString> pendingReplyFiles;
     quint64 nextEventFileIndex = 0;
     quint64 requestCount = 0;
     quint64 replyCount = 0;
@@ -8,6 +8,9 @@
 #include <QImageReader>
 #include <QPainter>
 #include <QMouseEvent>
+#include <QPointer>
+#include <QThreadPool>
+#include <QCoreApplication>
 
 ImageView::ImageView(QWidget *parent) : QLabel(parent)
 {
@@ -15,27 +18,27 @@ ImageView::ImageView(QWidget *parent) : QLabel(parent)
 
     opacityEffect = new QGraphicsOpacityEffect(this);
     opacityEffect->setOpacity(1.0);
-    propsDict["Opacity"] = "1.0";
+    propSlots[PropId::Opacity] = "1.0";
     this->setGraphicsEffect(opacityEffect);
 }
 
 
-void ImageView::setSpecificProp(const QString& prop, const QString& value)
+void ImageView::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "Image") {
-        propsDict["Image"] = value;
-        propsDict["Offsets"] = "0,0";
+    if (prop == PropId::Image) {
+        propSlots[PropId::Image] = value;
+        propSlots[PropId::Offsets] = "0,0";
         loadImage(value);
 
-    } else if (prop == "Scaling") {
+    } else if (prop == PropId::Scaling) {
         scale(value);
 
-    } else if (prop == "Offsets") {
-        propsDict["Offsets"] = value;
+    } else if (prop == PropId::Offsets) {
+        propSlots[PropId::Offsets] = value;
         moveByOffset(value);
 
-    } else if (prop == "Opacity") {
-        propsDict["Opacity"] = value;
+    } else if (prop == PropId::Opacity) {
+        propSlots[PropId::Opacity] = value;
         bool ok;
         double doubleValue = value.toDouble(&ok);
         if (ok) {
@@ -46,23 +49,23 @@ void ImageView::setSpecificProp(const QString& prop, const QString& value)
 }
 
 
-QString ImageView::getSpecificProp(const QString& prop)
+QString ImageView::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Image") {
-        value = propsDict["Image"];
+    if (prop == PropId::Image) {
+        value = propSlots[PropId::Image];
 
-    } else if (prop == "Scaling") {
+    } else if (prop == PropId::Scaling) {
         value = getCurrentScaling();
 
-    } else if (prop == "Offsets") {
-        value = propsDict["Offsets"];
+    } else if (prop == PropId::Offsets) {
+        value = propSlots[PropId::Offsets];
 
-    } else if (prop == "Opacity") {
-        value = propsDict["Opacity"];
+    } else if (prop == PropId::Opacity) {
+        value = propSlots[PropId::Opacity];
 
-    } else if (prop == "Dimensions") {
+    } else if (prop == PropId::Dimensions) {
         value = QString::number(image.width()) + "," + QString::number(image.height());
     }
 
@@ -70,21 +73,97 @@ QString ImageView::getSpecificProp(const QString& prop)
 }
 
 
-void ImageView::loadImage(const QString &path)
+// Few threads are enough: a client setting many images in a row only
+// needs the last one decoded, the others are skipped. On quit, waiting
+// tasks are dropped and running ones finish while the application is
+// still there to take their results.
+static QThreadPool *decodePool()
 {
-    QImageReader reader(AppPaths::cleanAbsPath(path));
+    static QThreadPool pool;
+    static bool configured = false;
+
+    if ( ! configured) {
+        pool.setMaxThreadCount(2);
+        QObject::connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, []() {
+            pool.clear();
+            pool.waitForDone();
+        });
+        configured = true;
+    }
+
+    return &pool;
+}
+
 
-    // rotate image, if written so in JPG Exif data
-    reader.setAutoTransform(true);
-    image = QPixmap::fromImage(reader.read());
+// Decoding a big JPEG takes long, so it runs in a thread pool and the
+// request is answered at once. Until the image is there, a placeholder
+// is shown and Dimensions is 0,0.
+void ImageView::loadImage(const QString &path)
+{
+    std::shared_ptr<std::atomic<quint64>> latestGeneration = loadGeneration;
+    quint64 generation = ++*latestGeneration;
+    QString absPath = AppPaths::cleanAbsPath(path);
+    QPointer<ImageView> self(this);
+
+    image = QPixmap();
+    scaledCache = QPixmap();
+    scaledCacheImageKey = 0;
+    loading = true;
     scalingMode = "AutoShrink";
-    computeScaling(true);
     offset = QPoint(0, 0);
 
+    decodePool()->start([self, latestGeneration, generation, absPath]() {
+        if (*latestGeneration != generation) {
+            return;  // Another image was set meanwhile
+        }
+
+        QImageReader reader(absPath);
+
+        // rotate image, if written so in JPG Exif data
+        reader.setAutoTransform(true);
+        QImage decoded = reader.read();
+
+        // The result goes to the GUI thread, self is only looked at there.
+        // Without a regular quit, the pool is only waited for when static
+        // objects are destroyed. The application is gone then.
+        QCoreApplication *app = QCoreApplication::instance();
+        if ( ! app) {
+            return;
+        }
+
+        QMetaObject::invokeMethod(app, [self, generation, decoded]() {
+            if (self) {
+                self->imageDecoded(generation, decoded);
+            }
+        }, Qt::QueuedConnection);
+    });
+
     update();
 }
 
 
+void ImageView::imageDecoded(quint64 generation, const QImage &decoded)
+{
+    if (generation != *loadGeneration) {
+        return;
+    }
+
+    image = QPixmap::fromImage(decoded);
+    loading = false;
+    computeScaling(true);
+
+    update();
+
+    if (hasEvent(ControlEvent::ImageLoaded)) {
+        emit imageViewEvent(propSlots[PropId::Name],
+                            "ImageLoaded`" +
+                            QString::number(image.width()) + "," +
+                            QString::number(image.height())
+                            );
+    }
+}
+
+
 double ImageView::computeScaling(bool apply)
 {
     if (image.isNull())
@@ -144,11 +223,11 @@ void ImageView::moveByOffset(const QString &offsetStr)
 
 void ImageView::mousePressEvent(QMouseEvent *event)
 {
-    if (propsDict["Events"].contains("ClickedAtPos")) {
+    if (hasEvent(ControlEvent::ClickedAtPos)) {
         int x = qFloor(event->position().x());
         int y = qFloor(event->position().y());
 
-        emit imageViewEvent(propsDict["Name"],
+        emit imageViewEvent(propSlots[PropId::Name],
                             "ClickedAtPos`" +
                             QString::number(x) + "," +
                             QString::number(y)
@@ -166,11 +245,56 @@ void ImageView::mousePressEvent(QMouseEvent *event)
 }
 
 
+// The cache is keyed on scaling, device pixel ratio and image. The widget
+// size only matters through the scaling (AutoShrink) and what is visible.
+void ImageView::updateScaledCache(double effScaling, qreal dpr, const QRectF &visibleRect)
+{
+    QRectF scaledRect(QPointF(0, 0), QSizeF(image.size()) * effScaling);
+    QRectF neededRect = visibleRect.intersected(scaledRect);
+
+    bool keyChanged = scaledCacheScaling != effScaling || scaledCacheDpr != dpr ||
+                      scaledCacheImageKey != image.cacheKey();
+
+    if ( ! keyChanged && (neededRect.isEmpty() || scaledCacheRect.contains(neededRect))) {
+        return;
+    }
+
+    QSizeF deviceSize = scaledRect.size() * dpr;
+    QRect sourceRect = image.rect();
+
+    if (qint64(deviceSize.width()) * qint64(deviceSize.height()) > maxScaledPixels) {
+        QRectF marginRect = visibleRect.adjusted(-visibleRect.width(), -visibleRect.height(),
+                                                 visibleRect.width(), visibleRect.height());
+        QRectF sourceF(marginRect.topLeft() / effScaling, marginRect.size() / effScaling);
+
+        sourceRect = sourceF.toAlignedRect().intersected(image.rect());
+    }
+
+    QSize targetSize = (QSizeF(sourceRect.size()) * effScaling * dpr).toSize();
+
+    if (sourceRect == image.rect()) {
+        scaledCache = image.scaled(targetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    } else {
+        scaledCache = image.copy(sourceRect).scaled(targetSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    }
+    scaledCache.setDevicePixelRatio(dpr);
+
+    scaledCacheRect = QRectF(QPointF(sourceRect.topLeft()) * effScaling, QSizeF(sourceRect.size()) * effScaling);
+    scaledCacheScaling = effScaling;
+    scaledCacheDpr = dpr;
+    scaledCacheImageKey = image.cacheKey();
+}
+
+
 void ImageView::paintEvent(QPaintEvent *event)
 {
     QLabel::paintEvent(event);
 
     if (image.isNull()) {
+        if (loading) {
+            QPainter painter(this);
+            painter.drawText(rect(), Qt::AlignCenter, tr("Loading..."));
+        }
         return;
     }
 
@@ -179,12 +303,10 @@ void ImageView::paintEvent(QPaintEvent *event)
 
     qreal dpr = devicePixelRatioF();
     double effScaling = computeScaling(false);
-    QSize targetSize = image.size() * effScaling * dpr;
-
-    QPixmap pix = image.scaled(targetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
-    pix.setDevicePixelRatio(dpr);
 
-    QPointF drawPos = QPointF(0, 0) - (offset * computeScaling(false));
-    painter.drawPixmap(drawPos.toPoint(), pix);
+    QPointF scaledOffset = offset * effScaling;
+    updateScaledCache(effScaling, dpr, QRectF(scaledOffset, QSizeF(size())));
 
+    QPointF drawPos = scaledCacheRect.topLeft() - scaledOffset;
+    painter.drawPixmap(drawPos.toPoint(), scaledCache);
 }
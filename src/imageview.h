@@ -6,6 +6,8 @@
 
 #include <QLabel>
 #include <QGraphicsOpacityEffect>
+#include <atomic>
+#include <memory>
 #include "control.h"
 
 class ImageView : public QLabel, public Control
@@ -15,19 +17,41 @@ class ImageView : public QLabel, public Control
 public:
     explicit ImageView(QWidget *parent = nullptr);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 signals:
     void imageViewEvent(const QString &name, const QString &event);
 
+private slots:
+    void imageDecoded(quint64 generation, const QImage &decoded);
+
 protected:
     void mousePressEvent(QMouseEvent *event) override;
     void paintEvent(QPaintEvent *event) override;
 
 private:
+    // Scaled images above this size (device pixels) are not scaled as a
+    // whole, only the visible part plus a margin of one view each side
+    static constexpr qint64 maxScaledPixels = 4096 * 4096;
+
     QPixmap image;
     QImage scaledImage;
+
+    // Images are decoded in a thread pool. Every load gets a new
+    // generation, which the decode tasks share: a task that is already
+    // outdated when it starts skips decoding, results of an older
+    // generation are dropped.
+    std::shared_ptr<std::atomic<quint64>> loadGeneration = std::make_shared<std::atomic<quint64>>(0);
+    bool loading = false;
+
+    // Result of the last scaling, reused as long as the key is the same
+    // and it covers what is visible. Panning then only blits.
+    QPixmap scaledCache;
+    QRectF scaledCacheRect;         // Part of the image it shows, in scaled coordinates
+    double scaledCacheScaling = 0.0;
+    qreal scaledCacheDpr = 0.0;
+    qint64 scaledCacheImageKey = 0;
     QGraphicsOpacityEffect *opacityEffect = nullptr;
 
     double scaling = 1.0;
@@ -41,6 +65,7 @@ private:
     void scale(const QString &strScaling);
 
     void moveByOffset(const QString &offset);
+    void updateScaledCache(double effScaling, qreal dpr, const QRectF &visibleRect);
 };
 
 #endif // IMAGEVIEW_H
@@ -24,15 +24,25 @@ void Initializer::parseCmdParamsToConfig(QCoreApplication &app, AppConfig &confi
     parser.setApplicationDescription("PeasyGUI");
     parser.addHelpOption();
 
-    QCommandLineOption protocolOpt("protocol", "Protocol: tcp or filebased", "protocol");
+    QCommandLineOption protocolOpt("protocol", "Protocol: tcp, local, shm or filebased", "protocol");
     QCommandLineOption portOpt("port", "TCP port", "port", "10000");
+    QCommandLineOption pushPortOpt("push_port", "TCP port for pushing events to the client (0 = off)", "push_port", "0");
+    QCommandLineOption maxClientsOpt("max_clients", "Number of TCP clients connected at the same time", "max_clients", "1");
     QCommandLineOption ipOpt("ip", "Bind to this IP address", "ip", "127.0.0.1");
+    QCommandLineOption framingOpt("framing", "Framing of TCP messages: none or length", "framing", "none");
+    QCommandLineOption socketNameOpt("socket_name", "Name of the local socket / named pipe", "socket_name", "PeasyGUI");
+    QCommandLineOption shmKeyOpt("shm_key", "Native key of the shared memory segment", "shm_key", "PeasyGUI");
     QCommandLineOption exchangeOpt("exchange_dir", "Temp dir for info exchange in filebased mode", "exchange_dir");
     QCommandLineOption iniOpt("ini", "Path of the initialization file", "ini", "PeasyGUI.ini");
 
     parser.addOption(protocolOpt);
     parser.addOption(portOpt);
+    parser.addOption(pushPortOpt);
+    parser.addOption(maxClientsOpt);
     parser.addOption(ipOpt);
+    parser.addOption(framingOpt);
+    parser.addOption(socketNameOpt);
+    parser.addOption(shmKeyOpt);
     parser.addOption(exchangeOpt);
     parser.addOption(iniOpt);
 
@@ -44,13 +54,22 @@ void Initializer::parseCmdParamsToConfig(QCoreApplication &app, AppConfig &confi
 
     if (protocol == "tcp") {
         config.mode = AppMode::TCP;
+    } else if (protocol == "local") {
+        config.mode = AppMode::Local;
+    } else if (protocol == "shm") {
+        config.mode = AppMode::SharedMemory;
     } else if (protocol == "filebased") {
         config.mode = AppMode::FileBased;
     }
 
     // Server settings --
     config.port = parser.value("port").toUShort();
+    config.pushPort = parser.value(pushPortOpt).toUShort();
+    config.maxClients = qMax(1, parser.value(maxClientsOpt).toInt());
     config.ip = parser.value("ip");
+    config.framed = (parser.value(framingOpt).toLower() == "length");
+    config.socketName = parser.value(socketNameOpt);
+    config.shmKey = parser.value(shmKeyOpt);
 
     // Paths and dirs of the textfiles --
     iniPath = AppPaths::cleanAbsPath(parser.value("ini"));
@@ -73,22 +92,27 @@ void Initializer::writeToIniFile(const QString &content)
 }
 
 
+// The file is handed out in chunks, so the controls of a big file are
+// already created while the rest is still being read
 void Initializer::readIniFile()
 {
-    QString content = "";
+    const qint64 chunkSize = 64 * 1024;
 
     QFile file(iniPath);
     if (file.open(QIODevice::ReadOnly)) {
-        QByteArray rawData = file.readAll();
+        while ( ! file.atEnd()) {
+            QByteArray chunk = file.read(chunkSize);
+            chunk.replace('\r', QByteArray());
+
+            emit iniFileChunkRead(chunk, false);
+        }
         file.close();
 
-        content = QString::fromUtf8(rawData).remove('\r');
+        emit iniFileChunkRead(QByteArray(), true);
     } else {
         qInfo() << "There was no Ini file at:" << iniPath;
 
         // Setting at least a good initial Window size
-        content = "set`Window`Geometry`60,60,300,500`";
+        emit iniFileChunkRead("set`Window`Geometry`60,60,300,500`", true);
     }
-
-    emit iniFileRead(content, false);
 }
@@ -21,7 +21,7 @@ public:
     void readIniFile();
 
 signals:
-    void iniFileRead(const QString& content, bool replyExpected);
+    void iniFileChunkRead(const QByteArray& chunk, bool isLastChunk);
 
 public slots:
     void writeToIniFile(const QString& content);
@@ -9,19 +9,19 @@ Label::Label(QWidget *parent) : QLabel(parent), Control(parent)
 }
 
 
-void Label::setSpecificProp(const QString& prop, const QString& value)
+void Label::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         this->setText(value);
     }
 }
 
 
-QString Label::getSpecificProp(const QString& prop)
+QString Label::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         value = this->text();
     }
 
@@ -15,8 +15,8 @@ class Label : public QLabel, public Control
 public:
     explicit Label(QWidget *parent = 0);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 };
 
@@ -5,27 +5,52 @@
 #include "QStringList"
 #include "QString"
 
-ListBox::ListBox(QWidget *parent) : QListWidget(parent), Control(parent)
+ListBox::ListBox(QWidget *parent) : QListView(parent), Control(parent)
 {
-    connect(this, &QListWidget::itemClicked, this, &ListBox::processClick);
-    connect(this, &QListWidget::itemDoubleClicked, this, &ListBox::processDoubleClick);
-    connect(this, &QListWidget::itemSelectionChanged, this, &ListBox::processSelectionChange);
+    listModel = new ListBoxModel(this);
+
+    this->setModel(listModel);
+    this->setUniformItemSizes(true);
+    this->setSelectionMode(QAbstractItemView::SingleSelection);
+    this->setEditTriggers(QAbstractItemView::NoEditTriggers);
+
+    connect(this, &QListView::clicked, this, &ListBox::processClick);
+    connect(this, &QListView::doubleClicked, this, &ListBox::processDoubleClick);
+    connect(this->selectionModel(), &QItemSelectionModel::selectionChanged, this, &ListBox::processSelectionChange);
 }
 
 
-void ListBox::setSpecificProp(const QString& prop, const QString& value)
+void ListBox::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "EntireTexts") {
-        this->clear();
-        QStringList items = value.split("`");
+    if (prop == PropId::EntireTexts) {
+        listModel->setEntireTexts(value);
+        this->clearSelection();
 
-        if (! (items.size() == 1 && items[0].isEmpty())) {
-            this->addItems(items);
+    } else if (prop == PropId::AppendTexts) {
+        // Editing rows can change the selection (e.g. a selected row is
+        // removed). That is no selection by the user, so it must not end
+        // up as SelectionChanged.
+        QSignalBlocker blocker(this->selectionModel());
+        listModel->appendTexts(value);
+
+    } else if (prop == PropId::InsertTexts || prop == PropId::ReplaceTexts) {
+        QSignalBlocker blocker(this->selectionModel());
+        int row;
+        QString texts;
+
+        if (splitRowAndTexts(value, row, texts)) {
+            if (prop == PropId::InsertTexts) {
+                listModel->insertTexts(row, texts);
+            } else {
+                listModel->replaceTexts(row, texts);
+            }
         }
 
-        this->clearSelection();
+    } else if (prop == PropId::RemoveRows) {
+        QSignalBlocker blocker(this->selectionModel());
+        listModel->removeRows(value.section(',', 0, 0).toInt(), value.section(',', 1, 1).toInt());
 
-    } else if (prop == "MultiSelect") {
+    } else if (prop == PropId::MultiSelect) {
         if (value == "True") {
             this->setSelectionMode(QAbstractItemView::ExtendedSelection);
         } else {
@@ -35,74 +60,83 @@ void ListBox::setSpecificProp(const QString& prop, const QString& value)
         this->clearSelection();
 
 
-    } else if (prop == "Selected") {
+    } else if (prop == PropId::Selected) {
         QStringList wishSelected = value.split(",");
 
-        QSignalBlocker blocker(this);
+        QSignalBlocker blocker(this->selectionModel());
         this->clearSelection();
 
         for (int idxWish = 0; idxWish < wishSelected.size(); idxWish++) {
             if ( ! wishSelected[idxWish].isEmpty()) {
-                this->item(wishSelected[idxWish].toInt())->setSelected(true);
+                QModelIndex index = listModel->index(wishSelected[idxWish].toInt());
+                this->selectionModel()->select(index, QItemSelectionModel::Select);
             }
         }
+
+        // The view is not told while the selection model is blocked
+        this->viewport()->update();
     }
 }
 
 
-QString ListBox::getSpecificProp(const QString& prop)
+QString ListBox::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "EntireTexts") {
-        for (int row = 0; row < this->count(); row++) {
-            value = value + this->item(row)->text() + "`";
-        }
-
-        if (value.contains("`")) {
-            value.chop(1);
-        }
+    if (prop == PropId::EntireTexts) {
+        value = listModel->entireTexts();
 
-    } else if (prop == "MultiSelect") {
+    } else if (prop == PropId::MultiSelect) {
         if (this->selectionMode() == QAbstractItemView::ExtendedSelection) {
             value = "True";
         } else {
             value = "False";
         }
 
-    } else if (prop == "Selected") {
+    } else if (prop == PropId::Selected) {
         value = getSelectedCommaSeparated();
 
+    } else if (prop == PropId::ItemCount) {
+        value = QString::number(listModel->rowCount());
+
     }
 
     return value;
 }
 
 
+QString ListBox::getPropRange(PropId prop, int offset, int length)
+{
+    if (prop == PropId::EntireTexts) {
+        return listModel->textsOfRows(offset, length);
+    }
+
+    return Control::getPropRange(prop, offset, length);
+}
+
+
 void ListBox::processClick()
 {
-    // The word "DoubleClicked" contains the Word "Clicked"
-    QString workaroundPartOfName = "," + propsDict["Events"];
-    if (workaroundPartOfName.contains(",Clicked")) {
-        emit listBoxEvent(propsDict["Name"], "Clicked`" + QString::number(this->currentRow()));
+    if (hasEvent(ControlEvent::Clicked)) {
+        emit listBoxEvent(propSlots[PropId::Name], "Clicked`" + QString::number(this->currentIndex().row()));
     }
 }
 
 
 void ListBox::processDoubleClick()
 {
-    if (propsDict["Events"].contains("DoubleClicked")) {
-        emit listBoxEvent(propsDict["Name"], "DoubleClicked`" + QString::number(this->currentRow()));
+    if (hasEvent(ControlEvent::DoubleClicked)) {
+        emit listBoxEvent(propSlots[PropId::Name], "DoubleClicked`" + QString::number(this->currentIndex().row()));
     }
 }
 
 
 void ListBox::processSelectionChange()
 {
-    if (propsDict["Events"].contains("SelectionChanged")) {
+    if (hasEvent(ControlEvent::SelectionChanged)) {
         QString commaSeparated = getSelectedCommaSeparated();
 
-        emit listBoxEvent(propsDict["Name"], "SelectionChanged`" + commaSeparated);
+        emit listBoxEvent(propSlots[PropId::Name], "SelectionChanged`" + commaSeparated);
     }
 }
 
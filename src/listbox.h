@@ -4,18 +4,22 @@
 #ifndef LISTBOX_H
 #define LISTBOX_H
 
-#include <QListWidget>
+#include <QListView>
 #include "control.h"
+#include "listboxmodel.h"
 
-class ListBox : public QListWidget, public Control
+// Model/view list: the items live in ListBoxModel, the view only creates
+// what is visible. Uniform item sizes spare it from measuring every row.
+class ListBox : public QListView, public Control
 {
     Q_OBJECT
 
 public:
     explicit ListBox(QWidget *parent = nullptr);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
+    QString getPropRange(PropId prop, int offset, int length) override;
 
 signals:
     void listBoxEvent(const QString &name, const QString &event);
@@ -27,6 +31,8 @@ private slots:
 
 private:
     QString getSelectedCommaSeparated();
+
+    ListBoxModel *listModel;
 };
 
 #endif // LISTBOX_H
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "listboxmodel.h"
+
+// "" means no items, like in RequestChecker::countListItems()
+static int countItems(const QString &texts)
+{
+    return texts.isEmpty() ? 0 : int(texts.count('`') + 1);
+}
+
+ListBoxModel::ListBoxModel(QObject *parent) : QAbstractListModel(parent)
+{
+    starts.append(0);
+}
+
+
+void ListBoxModel::setEntireTexts(const QString &entireTexts)
+{
+    beginResetModel();
+
+    texts = entireTexts;
+    scanStarts();
+
+    endResetModel();
+}
+
+
+void ListBoxModel::scanStarts()
+{
+    starts.clear();
+    starts.append(0);
+
+    if ( ! texts.isEmpty()) {
+        starts.reserve(texts.count('`') + 2);
+
+        for (qsizetype pos = texts.indexOf('`'); pos >= 0; pos = texts.indexOf('`', pos + 1)) {
+            starts.append(pos + 1);
+        }
+
+        starts.append(texts.size() + 1);
+    }
+}
+
+
+const QString &ListBoxModel::entireTexts() const
+{
+    return texts;
+}
+
+
+QString ListBoxModel::itemText(int row) const
+{
+    if (row < 0 || row >= rowCount()) {
+        return QString();
+    }
+
+    qsizetype start = starts[row];
+    return texts.mid(start, starts[row + 1] - 1 - start);
+}
+
+
+// Like Control::sliceRows(), but without searching for the rows
+QString ListBoxModel::textsOfRows(int row, int count) const
+{
+    if (row < 0 || count <= 0 || row >= rowCount()) {
+        return QString();
+    }
+
+    int endRow = qMin(row + qsizetype(count), qsizetype(rowCount()));
+    qsizetype start = starts[row];
+
+    return texts.mid(start, starts[endRow] - 1 - start);
+}
+
+
+void ListBoxModel::appendTexts(const QString &newTexts)
+{
+    insertTexts(rowCount(), newTexts);
+}
+
+
+void ListBoxModel::insertTexts(int row, const QString &newTexts)
+{
+    int insertCount = countItems(newTexts);
+
+    if (insertCount == 0 || row < 0 || row > rowCount()) {
+        return;
+    }
+
+    beginInsertRows(QModelIndex(), row, row + insertCount - 1);
+    splice(row, 0, newTexts, insertCount);
+    endInsertRows();
+}
+
+
+void ListBoxModel::replaceTexts(int row, const QString &newTexts)
+{
+    int replaceCount = countItems(newTexts);
+
+    if (replaceCount == 0 || row < 0 || replaceCount > rowCount() - row) {
+        return;
+    }
+
+    splice(row, replaceCount, newTexts, replaceCount);
+    emit dataChanged(index(row), index(row + replaceCount - 1), {Qt::DisplayRole});
+}
+
+
+bool ListBoxModel::removeRows(int row, int count, const QModelIndex &parent)
+{
+    if (parent.isValid() || count <= 0 || row < 0 || count > rowCount() - row) {
+        return false;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row + count - 1);
+    splice(row, count, QString(), 0);
+    endRemoveRows();
+
+    return true;
+}
+
+
+// Replaces removeCount rows at row with the insertCount items of
+// insertTexts, in the string and in the offsets. The backticks between
+// the untouched rows and the new ones are added or removed as needed.
+void ListBoxModel::splice(int row, int removeCount, const QString &insertTexts, int insertCount)
+{
+    int oldRowCount = rowCount();
+
+    if (oldRowCount == removeCount) {
+        texts = insertTexts;
+        scanStarts();
+        return;
+    }
+
+    qsizetype pos = starts[row];
+    qsizetype length = 0;
+    qsizetype itemStart = pos;
+    QString replacement = insertTexts;
+
+    if (insertCount > 0 && removeCount > 0) {
+        length = starts[row + removeCount] - 1 - pos;
+
+    } else if (insertCount > 0 && row < oldRowCount) {
+        replacement += '`';
+
+    } else if (insertCount > 0) {
+        // Behind the last row: starts[row] is the end mark
+        pos = texts.size();
+        itemStart = pos + 1;
+        replacement.prepend('`');
+
+    } else if (row + removeCount < oldRowCount) {
+        length = starts[row + removeCount] - pos;
+
+    } else {
+        // Removed up to the end, the backtick in front of them goes too
+        pos--;
+        length = texts.size() - pos;
+    }
+
+    if (pos == texts.size()) {
+        texts.append(replacement);
+    } else {
+        texts.replace(pos, length, replacement);
+    }
+
+    // Rows behind the changed ones (and the end mark) move along
+    qsizetype shift = replacement.size() - length;
+
+    for (qsizetype idx = row + removeCount; idx < starts.size(); idx++) {
+        starts[idx] += shift;
+    }
+
+    if (insertCount != removeCount) {
+        starts.remove(row, removeCount);
+        starts.insert(row, insertCount, 0);
+    }
+
+    // Offsets of the new rows
+    if (insertCount > 0) {
+        int idxRow = row;
+        starts[idxRow++] = itemStart;
+
+        for (qsizetype at = insertTexts.indexOf('`'); idxRow < row + insertCount; at = insertTexts.indexOf('`', at + 1)) {
+            starts[idxRow++] = itemStart + at + 1;
+        }
+    }
+}
+
+
+int ListBoxModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+
+    return int(starts.size() - 1);
+}
+
+
+QVariant ListBoxModel::data(const QModelIndex &index, int role) const
+{
+    if (role != Qt::DisplayRole || ! index.isValid()) {
+        return QVariant();
+    }
+
+    return itemText(index.row());
+}
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef LISTBOXMODEL_H
+#define LISTBOXMODEL_H
+
+#include <QAbstractListModel>
+#include <QList>
+#include <QString>
+
+// Items of a ListBox, kept as one backtick-separated string, exactly as
+// they arrive with EntireTexts, plus the start offset of every item. No
+// object per row: loading 500k items is one scan for backticks, and the
+// view asks only for the rows it shows. Getting EntireTexts back is a
+// copy of the (implicitly shared) string.
+//
+// Appending only touches the end of the string and of the offsets, so
+// tailing a log costs the new rows, not all rows. Inserting, removing
+// or replacing in the middle moves the rest of the string once.
+class ListBoxModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit ListBoxModel(QObject *parent = nullptr);
+
+    void setEntireTexts(const QString &entireTexts);
+    const QString &entireTexts() const;
+    QString itemText(int row) const;
+    QString textsOfRows(int row, int count) const;
+
+    void appendTexts(const QString &newTexts);
+    void insertTexts(int row, const QString &newTexts);
+    void replaceTexts(int row, const QString &newTexts);
+    bool removeRows(int row, int count, const QModelIndex &parent = QModelIndex()) override;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private:
+    void scanStarts();
+    void splice(int row, int removeCount, const QString &insertTexts, int insertCount);
+
+    QString texts;
+
+    // starts[row] is where the item begins, starts[rowCount] lies one
+    // behind the end, as if there were a backtick after the last item
+    QList<qsizetype> starts;
+};
+
+#endif // LISTBOXMODEL_H
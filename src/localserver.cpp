@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "localserver.h"
+#include "requestparser.h"
+
+LocalServer::LocalServer(const AppConfig &config, QObject *parent)
+    : QObject(parent), server(this), pushServer(this)
+{
+    socketName = config.socketName;
+    framed = config.framed;
+
+    // Instead of the IP filter of the TCP Server: only the same user may connect
+    server.setSocketOptions(QLocalServer::UserAccessOption);
+    pushServer.setSocketOptions(QLocalServer::UserAccessOption);
+
+    connect(&server, &QLocalServer::newConnection, this, &LocalServer::newConnection);
+    connect(&pushServer, &QLocalServer::newConnection, this, &LocalServer::newPushConnection);
+}
+
+
+bool LocalServer::listen(QLocalServer &localServer, const QString &name)
+{
+    bool listening = localServer.listen(name);
+
+    // A crashed instance may have left its socket file behind (Unix only).
+    // It is only removed if nobody answers on it, so a running instance
+    // with the same name keeps its socket.
+    if (!listening && localServer.serverError() == QAbstractSocket::AddressInUseError) {
+        QLocalSocket probe;
+        probe.connectToServer(name);
+
+        if (probe.waitForConnected(500)) {
+            probe.disconnectFromServer();
+            qWarning() << "Another instance is already listening on" << name;
+            return false;
+        }
+
+        QLocalServer::removeServer(name);
+        listening = localServer.listen(name);
+    }
+
+    if (!listening) {
+        qWarning() << localServer.errorString();
+        return false;
+    }
+
+    qInfo() << "Listening on" << localServer.fullServerName();
+    return true;
+}
+
+
+void LocalServer::start()
+{
+    if (listen(server, socketName)) {
+        // Second channel: events are written to it as they happen
+        listen(pushServer, socketName + "_events");
+    }
+}
+
+
+void LocalServer::quit()
+{
+    if (client) {
+        client->disconnectFromClient(1000);
+        client = nullptr;
+    }
+
+    if (pushClient) {
+        pushClient->disconnectFromClient(1000);
+        pushClient = nullptr;
+    }
+
+    server.close();
+    pushServer.close();
+}
+
+
+void LocalServer::newConnection()
+{
+    QLocalSocket* newSocket = server.nextPendingConnection();
+
+    if (client) {
+        client->disconnectFromClient();
+    }
+
+    client = new ClientConnection(newSocket, framed, this);
+
+    connect(client, &ClientConnection::messageReceived, this, &LocalServer::messageReceived);
+    connect(client, &ClientConnection::requestsReceived, this, &LocalServer::requestsReceived);
+    connect(client, &ClientConnection::disconnected, this, &LocalServer::disconnected);
+
+    qInfo() << "Connected:" << socketName;
+}
+
+
+void LocalServer::disconnected()
+{
+    ClientConnection* c = qobject_cast<ClientConnection*>(sender());
+    if (!c) {
+        return;
+    }
+
+    qInfo() << "Disconnected:" << c->peerName();
+
+    if (c == client) {
+        client = nullptr;
+    }
+
+    c->deleteLater();
+}
+
+
+void LocalServer::messageReceived(const QString &message, const QString &requestId)
+{
+    if (sender() != client) {
+        return;
+    }
+
+    pendingReplies.enqueue({client, requestId});
+    emit messageFromClientReceived(message, true);
+}
+
+
+void LocalServer::requestsReceived(const QList<Request> &requests, const QString &requestId)
+{
+    if (sender() != client) {
+        return;
+    }
+
+    pendingReplies.enqueue({client, requestId});
+    emit requestsFromClientReceived(requests, true);
+}
+
+
+void LocalServer::sendReplyToClient(const QString &message)
+{
+    if (pendingReplies.isEmpty()) {
+        qWarning() << "No pending request for this reply.";
+        return;
+    }
+
+    PendingReply pending = pendingReplies.dequeue();
+
+    // Replies to a replaced client are dropped, not sent to the new one
+    if (pending.client) {
+        pending.client->send(RequestParser::tagWithRequestId(message, pending.requestId));
+    } else {
+        qWarning() << "No valid socket to send reply.";
+    }
+}
+
+
+void LocalServer::newPushConnection()
+{
+    QLocalSocket* newSocket = pushServer.nextPendingConnection();
+
+    if (pushClient) {
+        disconnect(pushClient, nullptr, this, nullptr);
+        pushClient->disconnectFromClient();
+    }
+
+    // The push channel is one-way, anything the client sends is ignored
+    pushClient = new ClientConnection(newSocket, framed, this);
+    connect(pushClient, &ClientConnection::disconnected, this, &LocalServer::pushDisconnected);
+
+    emit eventSubscriptionChanged(true);
+}
+
+
+void LocalServer::pushDisconnected()
+{
+    ClientConnection* c = qobject_cast<ClientConnection*>(sender());
+    if (!c) {
+        return;
+    }
+
+    qInfo() << "Event subscriber disconnected:" << c->peerName();
+
+    if (c == pushClient) {
+        pushClient = nullptr;
+        emit eventSubscriptionChanged(false);
+    }
+
+    c->deleteLater();
+}
+
+
+void LocalServer::pushEventsToClient(const QString &events)
+{
+    if (pushClient) {
+        pushClient->send(events);
+    }
+}
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef LOCALSERVER_H
+#define LOCALSERVER_H
+
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QPointer>
+#include <QQueue>
+
+#include "appconfig.h"
+#include "clientconnection.h"
+
+// Same requests and replies as the TCP Server, but via a local socket
+// (Unix domain socket or Windows named pipe): no loopback TCP overhead
+// and no port collisions between many PeasyGUI instances on one host.
+class LocalServer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LocalServer(const AppConfig &config, QObject *parent = nullptr);
+
+signals:
+    void messageFromClientReceived(const QString& message, bool replyExpected);
+    void requestsFromClientReceived(const QList<Request>& requests, bool replyExpected);
+    void eventSubscriptionChanged(bool subscribed);
+
+public slots:
+    void start();
+    void quit();
+    void newConnection();
+    void disconnected();
+    void messageReceived(const QString& message, const QString& requestId);
+    void requestsReceived(const QList<Request>& requests, const QString& requestId);
+    void newPushConnection();
+    void pushDisconnected();
+
+    void sendReplyToClient(const QString& message);
+    void pushEventsToClient(const QString& events);
+
+private:
+    bool listen(QLocalServer &localServer, const QString &name);
+
+    QLocalServer server;
+    QLocalServer pushServer;
+
+    QPointer<ClientConnection> client;
+    QPointer<ClientConnection> pushClient;
+    QQueue<PendingReply> pendingReplies;
+
+    QString socketName;
+    bool framed;
+};
+
+#endif // LOCALSERVER_H
@@ -21,22 +21,34 @@ Components:
  - Server:          TCP server interface for runtime communication
                     with user programs.
 
+ - LocalServer:     Same as Server, but via local socket / named pipe.
+
+ - SharedMemoryServer: Same as Server, but via ring buffers in shared memory.
+
  - FileBasedServer: Alternative file-based interface for platforms
                     or languages where TCP is inconvenient.
 
  Modes:
  - Designer: GUI layout editor.
  - TCP: Live program-to-GUI communication via TCP.
+ - Local: Live program-to-GUI communication via local socket.
+ - SharedMemory: Live program-to-GUI communication via shared memory.
  - FileBased: Communication via temporary files.
+
+ In all modes except Designer, the server runs in a separate I/O thread and
+ talks to MainWin through queued signals only.
  
 */
 
 #include <QApplication>
+#include <QThread>
 
 #include "initializer.h"
 #include "mainwin.h"
 #include "toolboxwin.h"
 #include "server.h"
+#include "localserver.h"
+#include "sharedmemoryserver.h"
 #include "filebasedserver.h"
 #include "iconfreetooltip.h"
 
@@ -56,12 +68,17 @@ int main(int argc, char *argv[])
 
     MainWin mainWin(config);
 
-    QObject::connect(&initializer, &Initializer::iniFileRead, &mainWin, &MainWin::handleIniFileReadReady);
+    QObject::connect(&initializer, &Initializer::iniFileChunkRead, &mainWin, &MainWin::handleIniFileChunkRead);
 
     mainWin.show();
 
     initializer.readIniFile();
 
+    // The server of the chosen protocol runs in its own thread, so slow clients
+    // or big payloads never freeze the GUI. Signals to and from it are queued.
+    QThread ioThread;
+    QObject* ioWorker = nullptr;
+
     if (config.mode == AppMode::Designer) {
         ToolBoxWin* toolBoxWin = new ToolBoxWin;
 
@@ -81,22 +98,68 @@ int main(int argc, char *argv[])
         Server* server = new Server(config);
 
         QObject::connect(&mainWin, &MainWin::replyForClientPrepared, server, &Server::sendReplyToClient);
+        QObject::connect(&mainWin, &MainWin::eventsForClientPrepared, server, &Server::pushEventsToClient);
+        QObject::connect(server, &Server::eventSubscriptionChanged, &mainWin, &MainWin::setEventPushEnabled);
         QObject::connect(&mainWin, &MainWin::shutdownConnections, server, &Server::quit);
         QObject::connect(server, &Server::messageFromClientReceived, &mainWin, &MainWin::treatRequests);
-        QObject::connect(&app, &QCoreApplication::aboutToQuit, server, &Server::quit);
+        QObject::connect(server, &Server::requestsFromClientReceived, &mainWin, &MainWin::treatParsedRequests);
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, server, &Server::quit, Qt::BlockingQueuedConnection);
+
+        ioWorker = server;
+
+    } else if (config.mode == AppMode::Local) {
+        LocalServer* localServer = new LocalServer(config);
+
+        QObject::connect(&mainWin, &MainWin::replyForClientPrepared, localServer, &LocalServer::sendReplyToClient);
+        QObject::connect(&mainWin, &MainWin::eventsForClientPrepared, localServer, &LocalServer::pushEventsToClient);
+        QObject::connect(&mainWin, &MainWin::shutdownConnections, localServer, &LocalServer::quit);
+        QObject::connect(localServer, &LocalServer::messageFromClientReceived, &mainWin, &MainWin::treatRequests);
+        QObject::connect(localServer, &LocalServer::requestsFromClientReceived, &mainWin, &MainWin::treatParsedRequests);
+        QObject::connect(localServer, &LocalServer::eventSubscriptionChanged, &mainWin, &MainWin::setEventPushEnabled);
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, localServer, &LocalServer::quit, Qt::BlockingQueuedConnection);
+
+        ioWorker = localServer;
 
-        server->start();
+    } else if (config.mode == AppMode::SharedMemory) {
+        SharedMemoryServer* shmServer = new SharedMemoryServer(config);
+
+        QObject::connect(&mainWin, &MainWin::replyForClientPrepared, shmServer, &SharedMemoryServer::sendReplyToClient);
+        QObject::connect(&mainWin, &MainWin::shutdownConnections, shmServer, &SharedMemoryServer::quit);
+        QObject::connect(shmServer, &SharedMemoryServer::messageFromClientReceived, &mainWin, &MainWin::treatRequests);
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, shmServer, &SharedMemoryServer::quit, Qt::BlockingQueuedConnection);
+
+        ioWorker = shmServer;
 
     } else if (config.mode == AppMode::FileBased) {
         FileBasedServer* fileServer = new FileBasedServer(config);
 
         QObject::connect(&mainWin, &MainWin::replyForClientPrepared, fileServer, &FileBasedServer::sendReplyToClient);
+        QObject::connect(&mainWin, &MainWin::eventsForClientPrepared, fileServer, &FileBasedServer::pushEventsToClient);
+        QObject::connect(fileServer, &FileBasedServer::eventSubscriptionChanged, &mainWin, &MainWin::setEventPushEnabled);
         QObject::connect(&mainWin, &MainWin::shutdownConnections, fileServer, &FileBasedServer::quit);
         QObject::connect(fileServer, &FileBasedServer::messageFromClientReceived, &mainWin, &MainWin::treatRequests);
 
-        fileServer->start();
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, fileServer, &FileBasedServer::quit, Qt::BlockingQueuedConnection);
+
+        ioWorker = fileServer;
+
+    }
+
+    if (ioWorker) {
+        ioThread.setObjectName("PeasyGUI I/O");
+        // The servers create their sockets, timers etc. with themselves as
+        // parent, so all of them move along into the I/O thread
+        ioWorker->moveToThread(&ioThread);
+        QObject::connect(&ioThread, &QThread::finished, ioWorker, &QObject::deleteLater);
 
+        ioThread.start();
+        QMetaObject::invokeMethod(ioWorker, "start", Qt::QueuedConnection);
     }
 
-    return app.exec();
+    int exitCode = app.exec();
+
+    ioThread.quit();
+    ioThread.wait();
+
+    return exitCode;
 }
@@ -49,6 +49,9 @@ MainWin::MainWin(const AppConfig &config, QWidget *parent) :
     this->setProp("Type", "Window");
     this->setProp("QuitNow", "False");
     controls.append(static_cast<Control*>(this));
+    controlShadow.indexByName.insert("Window", 0);
+    controlShadow.types.append("Window");
+    controlCountByType.insert("Window", 1);
 
     // MainWin Resize event ---
     resizeEndTimer.setInterval(300);
@@ -98,71 +101,83 @@ void MainWin::collectPropsOfControl(int id)
 }
 
 
-void MainWin::setSpecificProp(const QString &prop, const QString &value)
+void MainWin::setSpecificProp(PropId prop, const QString &value)
 {
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         this->setWindowTitle(value);
 
-    } else if (prop == "Clipboard") {
+    } else if (prop == PropId::Clipboard) {
         clipboard->setText(value);
 
-    } else if (prop == "Events") {
-        if (value.contains("ClipboardChanged")) {
+    } else if (prop == PropId::Events) {
+        if (hasEvent(ControlEvent::ClipboardChanged)) {
             lastClipboard = clipboard->text();
             pollClipboardTimer.start();
         } else {
             pollClipboardTimer.stop();
         }
 
-    } else if (prop == "Icon") {
+    } else if (prop == PropId::Icon) {
         QIcon icon(AppPaths::cleanAbsPath(value));
         QApplication::setWindowIcon(icon);
 
-        propsDict["Icon"] = value;
+        propSlots[PropId::Icon] = value;
 
-    } else if (prop == "AboutHeading") {
+    } else if (prop == PropId::AboutHeading) {
         aboutAccess->setHeading(value);
         aboutAccess->repositionButton();
 
-    } else if (prop == "QuitNow") {
+    } else if (prop == PropId::QuitNow) {
         if (value == "True") {
             QTimer::singleShot(100, [=]() {
                 emit shutdownConnections();
                 QApplication::quit();
             });
         } else {
-            propsDict["QuitNow"] = value;
+            propSlots[PropId::QuitNow] = value;
         }
 
-    } else if (prop == "MessageBoxNow") {
+    } else if (prop == PropId::MessageBoxNow) {
         MessageBox::showMessage(value);
 
+    } else if (prop == PropId::EventQueueLimit) {
+        eventQueue.setCapacity(value.toInt());
+
+    } else if (prop == PropId::EventChunkSize) {
+        eventChunkSize = qMax(0, value.toInt());
+
     }
 }
 
 
-QString MainWin::getSpecificProp(const QString &prop)
+QString MainWin::getSpecificProp(PropId prop)
 {
     QString value = "";
 
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         value = this->windowTitle();
 
-    } else if (prop == "Icon") {
-        value = propsDict["Icon"];
+    } else if (prop == PropId::Icon) {
+        value = propSlots[PropId::Icon];
 
-    } else if (prop == "Clipboard") {
+    } else if (prop == PropId::Clipboard) {
         value = clipboard->text();
 
-    } else if (prop == "AboutHeading") {
+    } else if (prop == PropId::AboutHeading) {
         value = aboutAccess->heading();
 
-    } else if (prop == "QuitNow") {
-        value = propsDict["QuitNow"];
+    } else if (prop == PropId::QuitNow) {
+        value = propSlots[PropId::QuitNow];
 
-    } else if (prop == "MessageBoxNow") {
+    } else if (prop == PropId::MessageBoxNow) {
         value = "";
 
+    } else if (prop == PropId::EventQueueLimit) {
+        value = QString::number(eventQueue.capacity());
+
+    } else if (prop == PropId::EventChunkSize) {
+        value = QString::number(eventChunkSize);
+
     }
 
     return value;
@@ -172,25 +187,37 @@ QString MainWin::getSpecificProp(const QString &prop)
 void MainWin::treatRequests(const QString &content, bool replyExpected)
 {
     RequestParser parser;
-    auto requests = parser.parseAll(content);
+    treatParsedRequests(parser.parseAll(content), replyExpected);
+}
 
+
+// Returns false if an error prevented the requests from being applied
+bool MainWin::treatParsedRequests(const QList<Request> &requests, bool replyExpected)
+{
     if (requests.isEmpty()) {
-        return;
+        // Every request gets a reply, otherwise the client waits forever
+        if (replyExpected) {
+            emit replyForClientPrepared("OK");
+        }
+        return true;
     }
 
     QString finalReply;
     QString parsingError = requests.last().error;
+    bool applied = false;
 
     if ( ! parsingError.isEmpty()) {
         finalReply = "ERROR`" + parsingError + "`";
 
     } else {
-        QString plausibilityError = RequestChecker::checkAll(requests, controls);
+        QString plausibilityError = RequestChecker::checkAll(requests, controlShadow);
 
         if ( ! plausibilityError.isEmpty()) {
             finalReply = "ERROR`" + plausibilityError + "`";
 
         } else {
+            beginBatch(requests.size());
+
             for (const auto& request : requests) {
                 if (request.action == "new") {
                     spawnControl(request.value, request.name);
@@ -199,10 +226,13 @@ void MainWin::treatRequests(const QString &content, bool replyExpected)
                     fulfillSetRequest(request.name, request.prop, request.value);
 
                 } else {
-                    finalReply = fulfillInformationRequest(request.action, request.name, request.prop);
+                    finalReply = fulfillInformationRequest(request.action, request.name, request.prop, request.value);
 
                 }
             }
+
+            endBatch();
+            applied = true;
         }
     }
 
@@ -214,6 +244,7 @@ void MainWin::treatRequests(const QString &content, bool replyExpected)
         emit replyForClientPrepared(finalReply);
     }
 
+    return applied;
 }
 
 
@@ -225,9 +256,23 @@ void MainWin::fulfillSetRequest(const QString &name, const QString &prop, const
 
     controls[idxControl]->setProp(prop, value);
 
+    // The checker relies on this, without asking the controls
+    if (prop == "Name") {
+        controlShadow.indexByName.remove(name);
+        controlShadow.indexByName.insert(value, idxControl);
+
+    } else if (RequestChecker::changesListItems(prop) && controlShadow.listItemCounts.contains(idxControl)) {
+        int itemCount = controlShadow.listItemCounts[idxControl];
+        controlShadow.listItemCounts[idxControl] = RequestChecker::listItemCountAfter(prop, value, itemCount);
+    }
+
     if (designModeInitReady && mode == AppMode::Designer) {
-        // indirect refresh of ToolBoxWin table
-        collectPropsOfControl(idxControl);
+        // indirect refresh of ToolBoxWin table, once per batch
+        if (batchApplying) {
+            deferredPropsControlId = idxControl;
+        } else {
+            collectPropsOfControl(idxControl);
+        }
 
         if (prop == "Name") {
             emit nameOfControlHasChanged(name, value);
@@ -236,21 +281,62 @@ void MainWin::fulfillSetRequest(const QString &name, const QString &prop, const
 }
 
 
-QString MainWin::fulfillInformationRequest(const QString &action, const QString &name, const QString &prop)
+// A batch of several requests is applied with painting switched off, so
+// the window is repainted once at the end instead of after every request
+void MainWin::beginBatch(int requestCount)
+{
+    if (requestCount < 2) {
+        return;
+    }
+
+    batchApplying = true;
+    deferredPropsControlId = -1;
+    setUpdatesEnabled(false);
+}
+
+
+void MainWin::endBatch()
+{
+    if ( ! batchApplying) {
+        return;
+    }
+
+    batchApplying = false;
+    setUpdatesEnabled(true);
+
+    // The ToolBoxWin table shows one control, so the last one is enough
+    if (deferredPropsControlId >= 0) {
+        collectPropsOfControl(deferredPropsControlId);
+        deferredPropsControlId = -1;
+    }
+}
+
+
+// A get with range (offset,length) replies only that part of the value.
+// Paged by rows, an empty reply may be one empty row, so clients learn
+// the end from ItemCount, not from the reply.
+QString MainWin::fulfillInformationRequest(const QString &action, const QString &name, const QString &prop, const QString &range)
 {
     QString replyMessage;
     int idxControl = -1;
 
     if (action == "get") {
         idxControl = findControlIndexByName(name);
-        replyMessage = "OK`" + controls[idxControl]->getProp(prop) + "`";
+
+        if (range.isEmpty()) {
+            replyMessage = "OK`" + controls[idxControl]->getProp(prop) + "`";
+        } else {
+            int offset = range.section(',', 0, 0).toInt();
+            int length = range.section(',', 1, 1).toInt();
+
+            replyMessage = "OK`" + controls[idxControl]->getPropRange(propIdFromName(prop), offset, length) + "`";
+        }
 
     } else if (action == "events?") {
-        if (eventList.size() == 0) {
+        replyMessage = takeQueuedEvents(eventChunkSize);
+
+        if (replyMessage.isEmpty()) {
             replyMessage = "NONE";
-        } else {
-            replyMessage = eventList.join("");
-            eventList.clear();
         }
     }
 
@@ -258,11 +344,27 @@ QString MainWin::fulfillInformationRequest(const QString &action, const QString
 }
 
 
-void MainWin::handleIniFileReadReady(const QString &content, bool replyExpected)
+// Requests of the INI file are treated as soon as they are complete, the
+// complete ones of each chunk together. The first error (parsing or
+// plausibility) drops the requests of its chunk and all later chunks;
+// what came before stays applied.
+void MainWin::handleIniFileChunkRead(const QByteArray &chunk, bool isLastChunk)
 {
-    treatRequests(content, replyExpected);
-    designModeInitReady = true;
-    yPositionForSpawnedControls = 10;
+    QList<Request> requests = iniParser.feed(chunk);
+
+    if (isLastChunk) {
+        requests += iniParser.finish();
+    }
+
+    if ( ! treatParsedRequests(requests, false)) {
+        iniParser.stop();
+    }
+
+    if (isLastChunk) {
+        iniParser.reset();
+        designModeInitReady = true;
+        yPositionForSpawnedControls = 10;
+    }
 }
 
 
@@ -275,11 +377,11 @@ void MainWin::closeEvent(QCloseEvent *event)
         event->accept();
 
     } else {
-        if (propsDict["Events"].contains("Closed")) {
+        if (hasEvent(ControlEvent::Closed)) {
             // The user will quit the GUI by closing the window.
             // This is reported via the GUI as an event to the App. The App must
             // then send "set`Window`Quit`True`" to finally close the GUI.
-            emit windowEvent(propsDict["Name"], "Closed");
+            emit windowEvent(propSlots[PropId::Name], "Closed");
             this->hide();
             event->ignore();
 
@@ -291,19 +393,10 @@ void MainWin::closeEvent(QCloseEvent *event)
 }
 
 
+// Kept up to date on spawn and rename, so no control has to be asked
 int MainWin::findControlIndexByName(const QString &name)
 {
-    int idxFound = -1;
-    int idx = 0;
-
-    while((idxFound == -1) && (idx < controls.size())) {
-        if (controls[idx]->getProp("Name") == name) {
-            idxFound = idx;
-        }
-        idx++;
-    }
-
-    return idxFound;
+    return controlShadow.indexByName.value(name, -1);
 }
 
 
@@ -382,6 +475,12 @@ void MainWin::spawnControl(const QString &type, const QString &name = "")
         }
 
         controls.append(control);
+        controlShadow.indexByName.insert(newName, idxControl);
+        controlShadow.types.append(type);
+        if (RequestChecker::isListType(type)) {
+            controlShadow.listItemCounts[idxControl] = RequestChecker::countListItems(control->getProp("EntireTexts"));
+        }
+        controlCountByType[type]++;
 
     }    
 }
@@ -405,15 +504,7 @@ void MainWin::connectControlEvents(Control* control, const QString &type)
 
 int MainWin::countControlsOfThisType(const QString &type)
 {
-    int count = 0;
-
-    for (int i=0; i < controls.size(); i++) {
-        if (controls[i]->getProp("Type") == type) {
-            count++;
-        }
-    }
-
-    return count;
+    return controlCountByType.value(type, 0);
 }
 
 
@@ -422,15 +513,9 @@ QString MainWin::generateUniqueNameIfEmpty(const QString &name, const QString &t
     QString newName = name;
 
     if (newName == "") {
-        QStringList allExistingNames;
-
-        for (int i=0; i < controls.size(); i++) {
-            allExistingNames.append(controls[i]->getProp("Name"));
-        }
-
         newName = type + "_" + QString::number(typeCount);
 
-        while(allExistingNames.indexOf(newName) > -1) {
+        while(controlShadow.indexByName.contains(newName)) {
             typeCount++;
             newName = type + "_" + QString::number(typeCount);
         }
@@ -442,7 +527,43 @@ QString MainWin::generateUniqueNameIfEmpty(const QString &name, const QString &t
 
 void MainWin::addToEventQueue(const QString &name, const QString &event)
 {
-    eventList.append(name + "`" + event + "`\n");
+    if (eventPushEnabled) {
+        emit eventsForClientPrepared(name + "`" + event + "`\n");
+    } else {
+        eventQueue.append(name, event);
+    }
+}
+
+
+void MainWin::setEventPushEnabled(bool enabled)
+{
+    eventPushEnabled = enabled;
+
+    // Events from before the subscription are delivered at once
+    if (eventPushEnabled) {
+        QString events = takeQueuedEvents(0);
+
+        if ( ! events.isEmpty()) {
+            emit eventsForClientPrepared(events);
+        }
+    }
+}
+
+
+// Events lost by an overflow of the queue are reported first, as an event
+// of the Window
+QString MainWin::takeQueuedEvents(int maxEvents)
+{
+    QString events;
+
+    int dropped = eventQueue.takeDroppedCount();
+    if (dropped > 0) {
+        events = propSlots[PropId::Name] + "`EventsDropped`" + QString::number(dropped) + "`\n";
+    }
+
+    events += eventQueue.take(maxEvents);
+
+    return events;
 }
 
 
@@ -460,8 +581,8 @@ void MainWin::onResizeFinished()
 {
     if (isFirstResize) {
         isFirstResize = false;
-    } else if (propsDict["Events"].contains("Resized")) {
-        emit windowEvent(propsDict["Name"], "Resized`" +
+    } else if (hasEvent(ControlEvent::Resized)) {
+        emit windowEvent(propSlots[PropId::Name], "Resized`" +
                                                 QString::number(width()) + "," +
                                                 QString::number(height()));
     }
@@ -473,7 +594,7 @@ void MainWin::pollClipboard()
     const QString currentClipboard = clipboard->text();
     if (currentClipboard != lastClipboard) {
         lastClipboard = currentClipboard;
-        emit windowEvent(propsDict["Name"], "ClipboardChanged");
+        emit windowEvent(propSlots[PropId::Name], "ClipboardChanged");
     }
 }
 
@@ -526,7 +647,7 @@ bool MainWin::eventFilter(QObject* obj, QEvent* event)
         }
     } else if (event->type() == QEvent::KeyPress &&
                obj->objectName() == "MainWinClassWindow" &&
-               propsDict["Events"].contains("KeyPressed")) {
+               hasEvent(ControlEvent::KeyPressed)) {
         return interceptKeyForCustomEvent(static_cast<QKeyEvent *>(event));
     }
 
@@ -577,7 +698,7 @@ bool MainWin::interceptKeyForCustomEvent(QKeyEvent *event)
     if (isCustomEvent) {
         QString keyStr = convertKeysToString(event);
         if (!keyStr.isEmpty()) {
-            emit windowEvent(propsDict["Name"], "KeyPressed`" + keyStr);
+            emit windowEvent(propSlots[PropId::Name], "KeyPressed`" + keyStr);
         }
     }
 
@@ -6,11 +6,15 @@
 
 #include <QMainWindow>
 #include <QTimer>
+#include <QHash>
 
 #include "aboutaccess.h"
 #include "appconfig.h"
 #include "control.h"
 #include "controlhighlighter.h"
+#include "eventqueue.h"
+#include "requestparser.h"
+#include "requestchecker.h"
 
 class MainWin : public QMainWindow, public Control
 {
@@ -19,8 +23,8 @@ class MainWin : public QMainWindow, public Control
 public:
     MainWin(const AppConfig &config, QWidget *parent = nullptr);
     
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
     QWidget *detectControlUnderCursor(QEvent *event);
 
 signals:
@@ -28,14 +32,17 @@ signals:
     void appClosedControlsDataCollected(const QString& content);
     void shutdownConnections();
     void replyForClientPrepared(const QString& content);
+    void eventsForClientPrepared(const QString& events);
     void windowEvent(const QString &name, const QString &event);
     void newControlSpawned(const QString& nameOfControl);
     void nameOfControlHasChanged(const QString &oldName, const QString &newName);
 
 public slots:
     void treatRequests(const QString& content, bool replyExpected);
-    void handleIniFileReadReady(const QString& content, bool replyExpected);
+    bool treatParsedRequests(const QList<Request>& requests, bool replyExpected);
+    void handleIniFileChunkRead(const QByteArray& chunk, bool isLastChunk);
     void addToEventQueue(const QString& name, const QString& event);
+    void setEventPushEnabled(bool enabled);
     void collectAndEmitControlNames();
     void collectPropsOfControl(int id);
 
@@ -46,20 +53,29 @@ protected:
 private:
     AboutAccess *aboutAccess;
     QList<Control*> controls;
-    QStringList eventList;
+    ControlShadow controlShadow;
+    QHash<QString, int> controlCountByType;
+    EventQueue eventQueue;
     QTimer resizeEndTimer;
     QTimer pollClipboardTimer;
     QClipboard *clipboard;
     QString lastClipboard;
     AppMode mode;
     ControlHighlighter highlighter;
+    RequestParser iniParser;
 
     int yPositionForSpawnedControls = 10;
     const int idOfMainWindow = 0;
     bool isFirstResize = true;
     bool designModeInitReady = false;
+    bool eventPushEnabled = false;
+    int eventChunkSize = 0;
+    bool batchApplying = false;
+    int deferredPropsControlId = -1;
 
     void closeEvent(QCloseEvent *event) override;
+    void beginBatch(int requestCount);
+    void endBatch();
     void spawnControl(const QString &type, const QString &name);
     void fulfillSetRequest(const QString &name, const QString &prop, const QString &value);
     int countControlsOfThisType(const QString &type);
@@ -68,7 +84,8 @@ private:
     void connectControlEvents(Control *control, const QString &type);
     bool interceptKeyForCustomEvent(QKeyEvent *event);
     QString convertKeysToString(QKeyEvent *event);
-    QString fulfillInformationRequest(const QString &action, const QString &name, const QString &prop);
+    QString takeQueuedEvents(int maxEvents);
+    QString fulfillInformationRequest(const QString &action, const QString &name, const QString &prop, const QString &range);
     void highlightControl(int id);
 
 private slots:
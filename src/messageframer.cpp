@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "messageframer.h"
+
+#include <QtEndian>
+
+QByteArray MessageFramer::frame(const QByteArray &payload)
+{
+    QByteArray framed(headerSize, Qt::Uninitialized);
+    qToBigEndian<quint32>(quint32(payload.size()), framed.data());
+    framed.append(payload);
+
+    return framed;
+}
+
+
+void MessageFramer::append(const QByteArray &bytes)
+{
+    // Consumed bytes are dropped lazily, so many small frames in one big
+    // chunk do not shift the whole buffer once per frame
+    if (readPos > 0 && readPos >= buffer.size() / 2) {
+        buffer.remove(0, readPos);
+        readPos = 0;
+    }
+
+    buffer.append(bytes);
+}
+
+
+bool MessageFramer::takeMessage(QByteArray &payloadOut)
+{
+    if (error || buffer.size() - readPos < headerSize) {
+        return false;
+    }
+
+    const quint32 payloadSize = qFromBigEndian<quint32>(buffer.constData() + readPos);
+
+    if (payloadSize > maxPayloadSize) {
+        error = true;
+        return false;
+    }
+
+    if (buffer.size() - readPos - headerSize < qsizetype(payloadSize)) {
+        return false;
+    }
+
+    payloadOut = buffer.mid(readPos + headerSize, payloadSize);
+    readPos += headerSize + payloadSize;
+
+    if (readPos == buffer.size()) {
+        buffer.clear();
+        readPos = 0;
+    }
+
+    return true;
+}
+
+
+void MessageFramer::clear()
+{
+    buffer.clear();
+    readPos = 0;
+    error = false;
+}
+
+
+bool MessageFramer::hasError() const
+{
+    return error;
+}
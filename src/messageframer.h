@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef MESSAGEFRAMER_H
+#define MESSAGEFRAMER_H
+
+#include <QByteArray>
+
+// Framed protocol: every message is preceded by its payload size as
+// 4-byte unsigned big-endian integer. Bytes are collected until a frame
+// is complete, so messages split over several TCP segments, or packed
+// together into one, are handed out exactly as they were sent.
+class MessageFramer
+{
+public:
+    static constexpr int headerSize = 4;
+    static constexpr quint32 maxPayloadSize = 256 * 1024 * 1024;
+
+    static QByteArray frame(const QByteArray &payload);
+
+    void append(const QByteArray &bytes);
+    bool takeMessage(QByteArray &payloadOut);
+    void clear();
+
+    bool hasError() const;
+
+private:
+    QByteArray buffer;
+    qsizetype readPos = 0;
+    bool error = false;
+};
+
+#endif // MESSAGEFRAMER_H
@@ -15,13 +15,13 @@ PathDialogButton::PathDialogButton(QWidget *parent) : QPushButton(parent), Contr
 }
 
 
-void PathDialogButton::setSpecificProp(const QString& prop, const QString& value)
+void PathDialogButton::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "Text") {
-        propsDict["Text"] = value;
+    if (prop == PropId::Text) {
+        propSlots[PropId::Text] = value;
 
-    } else if (prop == "Icon") {
-        propsDict["Icon"] = value;
+    } else if (prop == PropId::Icon) {
+        propSlots[PropId::Icon] = value;
 
         this->setIcon(QIcon(AppPaths::cleanAbsPath(value)));
         this->setIconSize(QSize(this->width()-10, this->height()-10));
@@ -29,15 +29,15 @@ void PathDialogButton::setSpecificProp(const QString& prop, const QString& value
 }
 
 
-QString PathDialogButton::getSpecificProp(const QString& prop)
+QString PathDialogButton::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Text") {
-        value = propsDict["Text"];
+    if (prop == PropId::Text) {
+        value = propSlots[PropId::Text];
 
-    } else if (prop == "Icon") {
-        value = propsDict["Icon"];
+    } else if (prop == PropId::Icon) {
+        value = propSlots[PropId::Icon];
 
     }
 
@@ -50,41 +50,41 @@ void PathDialogButton::processClick()
     QString pathOrDir;
     QString suggestion;
 
-    if (propsDict["Category"] == "Path") {
-        suggestion = AppPaths::cleanAbsPath(propsDict["Suggestion"]);
+    if (propSlots[PropId::Category] == "Path") {
+        suggestion = AppPaths::cleanAbsPath(propSlots[PropId::Suggestion]);
 
-        if (propsDict["Type"] == "OpenButton") {
+        if (propSlots[PropId::Type] == "OpenButton") {
             pathOrDir = QFileDialog::getOpenFileName(
                 this,
-                propsDict["Text"],
+                propSlots[PropId::Text],
                 suggestion,
-                propsDict["Extensions"]
+                propSlots[PropId::Extensions]
                 );
 
         } else {
             pathOrDir = QFileDialog::getSaveFileName(
                 this,
-                propsDict["Text"],
+                propSlots[PropId::Text],
                 suggestion,
-                propsDict["Extensions"]
+                propSlots[PropId::Extensions]
                 );
         }
 
-    } else if (propsDict["Category"] == "Dir") {
-        suggestion = AppPaths::cleanAbsDir(propsDict["Suggestion"]);
+    } else if (propSlots[PropId::Category] == "Dir") {
+        suggestion = AppPaths::cleanAbsDir(propSlots[PropId::Suggestion]);
 
         pathOrDir = QFileDialog::getExistingDirectory(
             this,
-            propsDict["Text"],
+            propSlots[PropId::Text],
             suggestion
         );
     }
 
     if ( ! pathOrDir.isEmpty()) {
-        propsDict["Path"] = pathOrDir;
+        propSlots[PropId::Path] = pathOrDir;
 
-        if (propsDict["Events"].contains("Chosen")) {
-            emit pathDialogButtonEvent(propsDict["Name"], "Chosen`" + pathOrDir);
+        if (hasEvent(ControlEvent::Chosen)) {
+            emit pathDialogButtonEvent(propSlots[PropId::Name], "Chosen`" + pathOrDir);
         }
     }
 }
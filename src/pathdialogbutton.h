@@ -14,8 +14,8 @@ class PathDialogButton : public QPushButton, public Control
 public:
     explicit PathDialogButton(QWidget *parent = 0);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 signals:
     void pathDialogButtonEvent(const QString &name, const QString &event);
@@ -8,19 +8,19 @@ ProgressBar::ProgressBar(QWidget *parent) : QProgressBar(parent), Control(parent
 
 }
 
-void ProgressBar::setSpecificProp(const QString& prop, const QString& value)
+void ProgressBar::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "Value") {
+    if (prop == PropId::Value) {
         this->setValue(value.toInt());
     }
 }
 
 
-QString ProgressBar::getSpecificProp(const QString& prop)
+QString ProgressBar::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Value") {
+    if (prop == PropId::Value) {
         value = QString::number(this->value());
     }
 
@@ -14,8 +14,8 @@ class ProgressBar : public QProgressBar, public Control
 public:
     explicit ProgressBar(QWidget *parent = 0);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 };
 
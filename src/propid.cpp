@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "propid.h"
+
+#include <QHash>
+#include <QList>
+
+static const QList<QString> &allPropNames()
+{
+    static const QList<QString> names = {
+#define PEASY_PROP_NAME(name) QStringLiteral(#name),
+        PEASY_PROPS(PEASY_PROP_NAME)
+#undef PEASY_PROP_NAME
+        QString()
+    };
+
+    return names;
+}
+
+
+PropId propIdFromName(const QString &propName)
+{
+    static const QHash<QString, PropId> idByName = [] {
+        QHash<QString, PropId> hash;
+        const QList<QString> &names = allPropNames();
+
+        for (int idx = 0; idx < int(PropId::Unknown); idx++) {
+            hash.insert(names[idx], PropId(idx));
+        }
+
+        return hash;
+    }();
+
+    return idByName.value(propName, PropId::Unknown);
+}
+
+
+const QString &propNameOf(PropId prop)
+{
+    return allPropNames()[int(prop)];
+}
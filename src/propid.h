@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef PROPID_H
+#define PROPID_H
+
+#include <QString>
+#include <array>
+
+// All property names of the prototypes as one integer enum. Requests name
+// properties as strings; they are converted once at the entry of
+// Control::setProp()/getProp(), everything after that compares integers.
+//
+// Expand for new props at the end only: binary requests name properties
+// by their position here (see binaryrequestcodec.h), so inserting or
+// reordering would change the numbers all clients use.
+#define PEASY_PROPS(X) \
+    X(Name) X(Type) X(Geometry) X(Events) X(Text) X(Style) X(Show) \
+    X(ToolTip) X(MultiLine) X(MultiSelect) X(EntireTexts) X(Selected) \
+    X(Icon) X(Image) X(Scaling) X(Opacity) X(Offsets) X(Dimensions) \
+    X(State) X(Clipboard) X(QuitNow) X(AboutHeading) X(MessageBoxNow) \
+    X(Category) X(Extensions) X(Suggestion) X(Path) X(EntirePaths) \
+    X(DragStyle) X(Value) X(Min) X(Max) X(Orientation) X(MaxEventRate) \
+    X(EventQueueLimit) X(EventChunkSize) X(AppendTexts) X(InsertTexts) \
+    X(RemoveRows) X(ReplaceTexts) X(ItemCount)
+
+enum class PropId {
+#define PEASY_PROP_ENUM(name) name,
+    PEASY_PROPS(PEASY_PROP_ENUM)
+#undef PEASY_PROP_ENUM
+    Unknown
+};
+
+constexpr int propCount = int(PropId::Unknown);
+
+PropId propIdFromName(const QString &propName);
+const QString &propNameOf(PropId prop);
+
+// Values of the properties a control stores itself, one fixed slot per
+// PropId. Replaces a QMap keyed by name: no tree walk, no string compare
+// and no insertion of empty entries on read.
+class PropSlots
+{
+public:
+    QString &operator[](PropId prop) { return values[std::size_t(prop)]; }
+    const QString &operator[](PropId prop) const { return values[std::size_t(prop)]; }
+
+private:
+    std::array<QString, propCount> values;
+};
+
+#endif // PROPID_H
@@ -5,6 +5,7 @@
 #define REQUEST_H
 
 #include <QString>
+#include <QMetaType>
 
 struct Request {
     QString action;
@@ -14,4 +15,7 @@ struct Request {
     QString error;
 };
 
+// Binary requests arrive already parsed, queued across the I/O thread
+Q_DECLARE_METATYPE(Request)
+
 #endif // REQUEST_H
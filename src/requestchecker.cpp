@@ -23,52 +23,141 @@ void RequestChecker::checkOnlyOneInfoRequestInBlock(QString &result, const QList
     }
 }
 
-void RequestChecker::initializeVirtualsWithExistingControls(QStringList &controlNames, QStringList &controlTypes, ListBoxTexts &entireListBoxTexts, const QList<Control *> &controls)
+ControlShadow RequestChecker::shadowOfControls(const QList<Control *> &controls)
 {
+    ControlShadow shadow;
     QString type;
 
+    shadow.indexByName.reserve(controls.size());
+
     for (int idxControl = 0; idxControl < controls.size(); idxControl++) {
-        controlNames.append(controls[idxControl]->getProp("Name"));
+        shadow.indexByName.insert(controls[idxControl]->getProp("Name"), idxControl);
 
         type = controls[idxControl]->getProp("Type");
-        controlTypes.append(type);
-        if (type == "ListBox" || type == "DropDown") {
-            entireListBoxTexts[idxControl] = controls[idxControl]->getProp("EntireTexts");
+        shadow.types.append(type);
+        if (isListType(type)) {
+            shadow.listItemCounts[idxControl] = countListItems(controls[idxControl]->getProp("EntireTexts"));
         }
     }
+
+    return shadow;
+}
+
+bool RequestChecker::isListType(const QString &type)
+{
+    return type == "ListBox" || type == "DropDown";
 }
 
-void RequestChecker::appendVirtual(const QString &name, const QString &type, QStringList &controlNames, QStringList &controlTypes, ListBoxTexts &entireListBoxTexts)
+// Like it is done in ListBox: {""} means no items
+int RequestChecker::countListItems(const QString &entireTexts)
 {
-    if (type == "ListBox"  || type == "DropDown") {
-        entireListBoxTexts[controlNames.size()] = "";
+    if (entireTexts.isEmpty()) {
+        return 0;
     }
-    controlNames.append(name);
-    controlTypes.append(type);
+
+    return entireTexts.count('`') + 1;
 }
 
-QList<PropInfo> RequestChecker::getAllPropInfos(const QString& type, const Prototypes &prototypes) {
-    auto protoProps = prototypes.find(type);
-    if (protoProps != prototypes.end()) {
-        return protoProps.value();
+bool RequestChecker::changesListItems(const QString &prop)
+{
+    return prop == "EntireTexts" || prop == "AppendTexts" || prop == "InsertTexts" || prop == "RemoveRows";
+}
+
+// The item count of a list after the prop was set. ReplaceTexts keeps it.
+int RequestChecker::listItemCountAfter(const QString &prop, const QString &value, int itemCount)
+{
+    int row;
+    QString texts;
+
+    if (prop == "EntireTexts") {
+        return countListItems(value);
+
+    } else if (prop == "AppendTexts") {
+        return itemCount + countListItems(value);
+
+    } else if (prop == "InsertTexts") {
+        Control::splitRowAndTexts(value, row, texts);
+        return itemCount + countListItems(texts);
+
+    } else if (prop == "RemoveRows") {
+        return itemCount - value.section(',', 1, 1).toInt();
     }
 
-    return {};
+    return itemCount;
 }
 
-int RequestChecker::getControlIndexByName(const QString &name, const QStringList &controlNames)
+RequestChecker::VirtualControls::VirtualControls(const ControlShadow &shadow) : shadow(shadow)
 {
-    int idxFound = -1;
-    int idx = 0;
+}
 
-    while((idxFound == -1) && (idx < controlNames.size())) {
-        if (controlNames[idx] == name) {
-            idxFound = idx;
-        }
-        idx++;
+int RequestChecker::VirtualControls::indexOf(const QString &name) const
+{
+    auto added = addedNames.constFind(name);
+    if (added != addedNames.constEnd()) {
+        return added.value();
+    }
+
+    if (removedNames.contains(name)) {
+        return -1;
+    }
+
+    return shadow.indexByName.value(name, -1);
+}
+
+QString RequestChecker::VirtualControls::typeOf(int index) const
+{
+    if (index < shadow.types.size()) {
+        return shadow.types[index];
+    }
+
+    return addedTypes[index - shadow.types.size()];
+}
+
+int RequestChecker::VirtualControls::listItemCount(int index) const
+{
+    auto changed = changedListItemCounts.constFind(index);
+    if (changed != changedListItemCounts.constEnd()) {
+        return changed.value();
+    }
+
+    return shadow.listItemCounts.value(index, 0);
+}
+
+void RequestChecker::VirtualControls::append(const QString &name, const QString &type)
+{
+    int index = shadow.types.size() + addedTypes.size();
+
+    addedNames.insert(name, index);
+    addedTypes.append(type);
+
+    if (isListType(type)) {
+        changedListItemCounts[index] = 0;
+    }
+}
+
+void RequestChecker::VirtualControls::rename(const QString &oldName, const QString &newName)
+{
+    int index = indexOf(oldName);
+
+    if ( ! addedNames.remove(oldName)) {
+        removedNames.insert(oldName);
+    }
+
+    addedNames.insert(newName, index);
+}
+
+void RequestChecker::VirtualControls::setListItemCount(int index, int count)
+{
+    changedListItemCounts[index] = count;
+}
+
+QList<PropInfo> RequestChecker::getAllPropInfos(const QString& type, const Prototypes &prototypes) {
+    auto protoProps = prototypes.find(type);
+    if (protoProps != prototypes.end()) {
+        return protoProps.value();
     }
 
-    return idxFound;
+    return {};
 }
 
 void RequestChecker::checkControlExists(QString &result, const int index)
@@ -134,6 +223,11 @@ void RequestChecker::checkAllIntegers(QString& result, const QString& value, con
             return;
         }
 
+        if (allowed[idxBoth] == "P" && thisValue < 1) {
+            result = "Found value below 1, where at least 1 is expected";
+            return;
+        }
+
     }
 }
 
@@ -189,29 +283,13 @@ QString RequestChecker::getCheckRule(const QString &prop, const QList<PropInfo>&
     return "Internal Error";
 }
 
-void RequestChecker::swapOldNameByNewName(const QString &oldName, const QString &newName, QStringList &controlNames)
-{
-    for (int i = 0; i < controlNames.size(); i++) {
-        if (controlNames[i] == oldName) {
-            controlNames[i] = newName;
-            return;
-        }
-    }
-}
-
-void RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(QString& result, const QString& value, const QString &entireTexts)
+void RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(QString& result, const QString& value, int itemCount)
 {
     bool conversionOk;
     int idxSelection;
 
-    QStringList items = entireTexts.split("`");
     QStringList selections = value.split(",");
 
-    // prepare, items, like it is done in ListBox: {""} means no items
-    if (items.size() == 1 && items[0].isEmpty()) {
-        items.clear();
-    }
-
     // Empty "" is a valid option to select none
     if ( ! (selections.size() == 1 && selections[0].isEmpty()) ) {
         for (const QString& selection : selections) {
@@ -222,7 +300,7 @@ void RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(QString& result, c
                 return;
             }
 
-            if (idxSelection < 0 || idxSelection >= items.size()) {
+            if (idxSelection < 0 || idxSelection >= itemCount) {
                 result = "List indeces must be in range (0 ... item_count-1)";
                 return;
             }
@@ -231,6 +309,38 @@ void RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(QString& result, c
 
 }
 
+// ListInsert: "row`items", row may be one behind the last item
+// ListReplace: "row`items", all replaced rows must exist
+// ListRemove: "row,count", all removed rows must exist
+void RequestChecker::checkIfListEditIsInRangeOfItems(QString& result, const QString& value, const QString& rule, int itemCount)
+{
+    int row;
+    int rowCount;
+    QString texts;
+
+    if (rule == "ListRemove") {
+        checkAllIntegers(result, value, "Int:U,U");
+        if ( ! result.isEmpty()) {
+            return;
+        }
+
+        row = value.section(',', 0, 0).toInt();
+        rowCount = value.section(',', 1, 1).toInt();
+
+    } else {
+        if ( ! Control::splitRowAndTexts(value, row, texts) || row < 0) {
+            result = "The first value must be a positive integer row";
+            return;
+        }
+
+        rowCount = (rule == "ListReplace") ? countListItems(texts) : 0;
+    }
+
+    if (row > itemCount || rowCount > itemCount - row) {
+        result = "List rows must be in range (0 ... item_count)";
+    }
+}
+
 void RequestChecker::checkIfWindowShouldBeSpawned(QString& result, const QString& type)
 {
     if (type == "Window") {
@@ -238,24 +348,21 @@ void RequestChecker::checkIfWindowShouldBeSpawned(QString& result, const QString
     }
 }
 
-QString RequestChecker::checkAll(const QList<Request> &requests, const QList<Control *> &controls)
+QString RequestChecker::checkAll(const QList<Request> &requests, const ControlShadow &shadow)
 {
     QString result;
-    QStringList controlNames;
-    QStringList controlTypes;
     int index;
     QList<PropInfo> propInfos;
-    QMap<int, QString> entireListBoxTexts;
 
     checkOnlyOneInfoRequestInBlock(result, requests);
     RETURN_IF_ERROR
 
-    initializeVirtualsWithExistingControls(controlNames, controlTypes, entireListBoxTexts, controls);
+    VirtualControls virtuals(shadow);
 
     const Prototypes& prototypes = getPrototypes();
 
     for (const auto& request : requests) {
-        index = getControlIndexByName(request.name, controlNames);
+        index = virtuals.indexOf(request.name);
 
         if (request.action == "new") { // ##########################
             checkNewControlNameIsUnique(result, index);
@@ -272,22 +379,28 @@ QString RequestChecker::checkAll(const QList<Request> &requests, const QList<Con
             checkIfWindowShouldBeSpawned(result, request.value);
             RETURN_IF_ERROR
 
-            appendVirtual(request.name, request.value, controlNames, controlTypes, entireListBoxTexts);
+            virtuals.append(request.name, request.value);
 
         } else if (request.action == "get") { // ##########################
             checkControlExists(result, index);
             RETURN_IF_ERROR
 
-            propInfos = getAllPropInfos(controlTypes[index], prototypes);
+            propInfos = getAllPropInfos(virtuals.typeOf(index), prototypes);
 
             checkIfPropExists(result, request.prop, propInfos);
             RETURN_IF_ERROR
 
+            // Optional range: offset,length
+            if ( ! request.value.isEmpty()) {
+                checkAllIntegers(result, request.value, "Int:U,U");
+                RETURN_IF_ERROR
+            }
+
         } else if (request.action == "set") { // ##########################
             checkControlExists(result, index);
             RETURN_IF_ERROR
 
-            propInfos = getAllPropInfos(controlTypes[index], prototypes);
+            propInfos = getAllPropInfos(virtuals.typeOf(index), prototypes);
 
             checkIfPropExists(result, request.prop, propInfos);
             RETURN_IF_ERROR
@@ -298,7 +411,7 @@ QString RequestChecker::checkAll(const QList<Request> &requests, const QList<Con
             QString checkRule = getCheckRule(request.prop, propInfos);
 
             if (checkRule == "UniqueNColon") {
-                int indexOfNew = getControlIndexByName(request.value, controlNames);
+                int indexOfNew = virtuals.indexOf(request.value);
 
                 checkNewControlNameIsUnique(result, indexOfNew);
                 RETURN_IF_ERROR
@@ -306,10 +419,14 @@ QString RequestChecker::checkAll(const QList<Request> &requests, const QList<Con
                 checkControlNameContainsColon(result, request.value);
                 RETURN_IF_ERROR
 
-                swapOldNameByNewName(request.name, request.value, controlNames);
+                virtuals.rename(request.name, request.value);
 
             } else if (checkRule == "IndecesInRange") {
-                checkIfSelectionIndecesAreInRangeOfItems(result, request.value, entireListBoxTexts[index]);
+                checkIfSelectionIndecesAreInRangeOfItems(result, request.value, virtuals.listItemCount(index));
+                RETURN_IF_ERROR
+
+            } else if (checkRule.startsWith("List")) {
+                checkIfListEditIsInRangeOfItems(result, request.value, checkRule, virtuals.listItemCount(index));
                 RETURN_IF_ERROR
 
             } else if (checkRule.startsWith("Int:")) {
@@ -325,8 +442,8 @@ QString RequestChecker::checkAll(const QList<Request> &requests, const QList<Con
                 RETURN_IF_ERROR
             }
 
-            if (request.prop == "EntireTexts") {
-                entireListBoxTexts[index] = request.value;
+            if (changesListItems(request.prop)) {
+                virtuals.setListItemCount(index, listItemCountAfter(request.prop, request.value, virtuals.listItemCount(index)));
             }
 
         }
@@ -5,11 +5,21 @@
 #define REQUESTCHECKER_H
 
 #include <QObject>
+#include <QHash>
+#include <QSet>
 #include "request.h"
 #include "controlprototypes.h"
 #include "control.h"
 
-using ListBoxTexts = QMap<int, QString>;
+using ControlIndex = QHash<QString, int>;
+
+// All the checker has to know about the existing controls. MainWin keeps
+// it up to date while applying requests, so it is not rebuilt per batch.
+struct ControlShadow {
+    ControlIndex indexByName;
+    QStringList types;
+    QHash<int, int> listItemCounts; // ListBox and DropDown only
+};
 
 class RequestChecker : public QObject
 {
@@ -17,15 +27,39 @@ class RequestChecker : public QObject
     Q_OBJECT
 
 public:
-    static QString checkAll(const QList<Request> &requests, const QList<Control*>& controls);
+    static QString checkAll(const QList<Request> &requests, const ControlShadow &shadow);
+
+    static ControlShadow shadowOfControls(const QList<Control*> &controls);
+    static bool isListType(const QString &type);
+    static int countListItems(const QString &entireTexts);
+    static bool changesListItems(const QString &prop);
+    static int listItemCountAfter(const QString &prop, const QString &value, int itemCount);
 
 private:
-    static void initializeVirtualsWithExistingControls(QStringList &controlNames, QStringList &controlTypes, ListBoxTexts &entireListBoxTexts, const QList<Control *> &controls);
-    static int getControlIndexByName(const QString &name, const QStringList &controlNames);
+    // The changes of the current batch on top of the shadow
+    class VirtualControls
+    {
+    public:
+        explicit VirtualControls(const ControlShadow &shadow);
+
+        int indexOf(const QString &name) const;
+        QString typeOf(int index) const;
+        int listItemCount(int index) const;
+
+        void append(const QString &name, const QString &type);
+        void rename(const QString &oldName, const QString &newName);
+        void setListItemCount(int index, int count);
+
+    private:
+        const ControlShadow &shadow;
+        ControlIndex addedNames;
+        QSet<QString> removedNames;
+        QStringList addedTypes;
+        QHash<int, int> changedListItemCounts;
+    };
+
     static QList<PropInfo> getAllPropInfos(const QString &type, const Prototypes &prototypes);
     static QString getCheckRule(const QString &prop, const QList<PropInfo> &propInfos);
-    static void appendVirtual(const QString &name, const QString &type, QStringList &controlNames, QStringList &controlTypes, ListBoxTexts &entireListBoxTexts);
-    static void swapOldNameByNewName(const QString &oldName, const QString &newName, QStringList &controlNames);
 
     static void checkControlExists(QString &result, const int index);
     static void checkOnlyOneInfoRequestInBlock(QString &result, const QList<Request> &requests);
@@ -35,7 +69,8 @@ private:
     static void checkControlNameContainsColon(QString &result, const QString &name);
     static void checkIfTypeExists(QString &result, const QString &prop, const QList<PropInfo> &propInfos);
     static void checkIfPropExists(QString &result, const QString &prop, const QList<PropInfo> &propInfos);
-    static void checkIfSelectionIndecesAreInRangeOfItems(QString& result, const QString& value, const QString &entireTexts);
+    static void checkIfSelectionIndecesAreInRangeOfItems(QString& result, const QString& value, int itemCount);
+    static void checkIfListEditIsInRangeOfItems(QString& result, const QString& value, const QString& rule, int itemCount);
     static void checkIfWindowShouldBeSpawned(QString &result, const QString &type);
     static void checkAllIntegers(QString &result, const QString &value, const QString &rule);
     static void checkValidSingle(QString &result, const QString &value, const QString &rule);
@@ -3,12 +3,25 @@
 
 #include "requestparser.h"
 
+// The input is split once into views of the original string. Nothing is
+// copied until a token ends up in a Request.
 QList<Request> RequestParser::parseAll(const QString &input)
 {
-    QStringList tokens = input.split('`');
+    const QList<QStringView> tokens = QStringView(input).split(u'`');
 
     QList<Request> parsedRequests;
 
+    QStringView lastTokenTrimmed = tokens.last().trimmed();
+
+    if ( ! lastTokenTrimmed.isEmpty() && lastTokenTrimmed != u"events?") {
+        Request request;
+        request.error = "All requests must end with a separator-char";
+        request.action = "No valid action";
+        parsedRequests.append(request);
+
+        return parsedRequests;
+    }
+
     int index = 0;
 
     while (index < tokens.size()) {
@@ -34,48 +47,266 @@ QList<Request> RequestParser::parseAll(const QString &input)
 }
 
 
-Request RequestParser::parseSingle(const QStringList &tokens, int &index)
+// Feeds the next piece of the input and returns all requests which are
+// complete now. The unfinished rest is kept until more bytes arrive.
+// UTF-8 sequences split between two pieces are handled by the decoder.
+// Like parseAll(), parsing stops at the first error.
+QList<Request> RequestParser::feed(const QByteArray &bytes)
 {
-    Request result;
+    QList<Request> parsedRequests;
+
+    if (stopped) {
+        return parsedRequests;
+    }
+
+    pendingText += decoder.decode(bytes);
+
+    if (valueStart >= 0 && ! continueListValue(parsedRequests)) {
+        return parsedRequests;
+    }
+
+    const QList<QStringView> tokens = QStringView(pendingText).split(u'`');
+    QStringView partialValue;
+
+    int index = 0;
+
+    while (index < tokens.size()) {
+        int startIndex = index;
+        bool incomplete = false;
+
+        Request request = parseSingle(tokens, index, &incomplete, &partialValue);
+
+        // wait for more bytes
+        if (incomplete) {
+            index = startIndex;
+            if ( ! partialValue.isNull()) {
+                listValueRequest = request;
+            }
+            break;
+        }
+
+        // empty token: wait, if it is the unfinished last one, else stop
+        if (request.action.isEmpty()) {
+            index = startIndex;
+            if (index < tokens.size() - 1) {
+                stopped = true;
+            }
+            break;
+        }
+
+        parsedRequests.append(request);
+
+        if (! request.error.isEmpty()) {
+            stopped = true;
+            break;
+        }
+    }
 
-    QString lastTokenTrimmed = tokens.last().trimmed();
+    if (stopped) {
+        pendingText.clear();
+    } else if (index < tokens.size()) {
+        qsizetype cut = tokens[index].data() - pendingText.constData();
 
-    if ( ! lastTokenTrimmed.isEmpty() && lastTokenTrimmed != "events?") {
-        result.error = "All requests must end with a separator-char";
-        result.action = "No valid action";
+        if ( ! partialValue.isNull()) {
+            valueStart = partialValue.data() - pendingText.constData() - cut;
+            scanPos = tokens.last().data() - pendingText.constData() - cut;
+        }
+
+        pendingText.remove(0, cut);
+    } else {
+        pendingText.clear();
+    }
+
+    return parsedRequests;
+}
+
+
+// Goes on with the list value of listValueRequest from scanPos, by the
+// same rules as CollectExtraValue in parseSingle(). Returns false while
+// the value is still unfinished.
+bool RequestParser::continueListValue(QList<Request> &parsedRequests)
+{
+    qsizetype tokenStart = scanPos;
+
+    while (true) {
+        qsizetype separator = pendingText.indexOf(u'`', tokenStart);
+        QStringView token = QStringView(pendingText).mid(tokenStart, separator < 0 ? -1 : separator - tokenStart);
+
+        if (separator < 0 && ! token.contains(u'\n')) {
+            scanPos = tokenStart;
+            return false;
+        }
+
+        if (token.trimmed().isEmpty() || token.contains(u'\n')) {
+            break;
+        }
+
+        tokenStart = separator + 1;
+    }
+
+    Request request = listValueRequest;
+    request.value = pendingText.mid(valueStart, tokenStart - 1 - valueStart);
+    parsedRequests.append(request);
+
+    pendingText.remove(0, tokenStart);
+    listValueRequest = Request();
+    valueStart = -1;
+    scanPos = 0;
+
+    return true;
+}
+
+
+// End of input: the rest is parsed as it is, incl. the check for the
+// final separator
+QList<Request> RequestParser::finish()
+{
+    QList<Request> parsedRequests;
 
-        return result;
+    if ( ! stopped) {
+        parsedRequests = parseAll(pendingText);
     }
 
+    reset();
+
+    return parsedRequests;
+}
+
+
+void RequestParser::reset()
+{
+    decoder.resetState();
+    pendingText.clear();
+    stopped = false;
+    listValueRequest = Request();
+    valueStart = -1;
+    scanPos = 0;
+}
+
+
+// The caller found an error in the requests so far: everything still
+// to come is dropped, up to the next reset()
+void RequestParser::stop()
+{
+    reset();
+    stopped = true;
+}
+
+
+// A message may start with an optional "#id`" tag. It is removed here and
+// prepended to the reply again, so clients with many requests in flight
+// can tell which reply belongs to which request.
+QString RequestParser::takeRequestId(QString &message)
+{
+    qsizetype start = 0;
+    while (start < message.size() && message[start].isSpace()) {
+        start++;
+    }
+
+    if (start >= message.size() || message[start] != '#') {
+        return QString();
+    }
+
+    qsizetype end = message.indexOf('`', start);
+    if (end <= start + 1) {
+        return QString();
+    }
+
+    QString requestId = message.mid(start + 1, end - start - 1);
+    message.remove(0, end + 1);
+
+    return requestId;
+}
+
+
+QString RequestParser::tagWithRequestId(const QString &reply, const QString &requestId)
+{
+    if (requestId.isEmpty()) {
+        return reply;
+    }
+
+    return "#" + requestId + "`" + reply;
+}
+
+
+// Values of these properties are lists: they go on over the following
+// backticks up to the end of the line, e.g. set`Box`AppendTexts`a`b`c`
+bool RequestParser::hasListValue(const QString &prop)
+{
+    return prop.startsWith("Entire") || prop == "AppendTexts" ||
+           prop == "InsertTexts" || prop == "ReplaceTexts";
+}
+
+
+// offset,length of a get, e.g. 100,50. Anything else after a get is
+// already the next request on the same line.
+static bool isRange(QStringView token)
+{
+    qsizetype comma = token.indexOf(u',');
+
+    if (comma <= 0 || comma == token.size() - 1) {
+        return false;
+    }
+
+    for (qsizetype idx = 0; idx < token.size(); idx++) {
+        if (idx != comma && (token[idx] < u'0' || token[idx] > u'9')) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+// With incomplete given, the last token is treated as unfinished: if it
+// would be needed for this request, *incomplete is set instead of an error.
+Request RequestParser::parseSingle(const QList<QStringView> &tokens, int &index, bool *incomplete,
+                                   QStringView *partialValue)
+{
+    Request result;
+
+    auto needsMoreInput = [&](int neededIndex) {
+        if (incomplete && neededIndex >= tokens.size() - 1) {
+            *incomplete = true;
+            return true;
+        }
+        return false;
+    };
+
     enum State {
         ExpectAction,
         ExpectName,
         ExpectProp,
         ExpectValue,
+        ExpectRange,
         CollectExtraValue,
         Done,
         Error
     };
 
     State state = ExpectAction;
-    QString valueAccum;
+    QStringView valueAccum;
 
     while (state != Done && state != Error) {
         switch (state) {
         case ExpectAction:
+            if (needsMoreInput(index)) {
+                return result;
+            }
+
             if (index < tokens.size()) {
-                QString trimmed = tokens[index].trimmed();
-                if (trimmed == "set" || trimmed == "new" || trimmed == "get" || trimmed == "events?") {
-                    result.action = trimmed;
+                QStringView trimmed = tokens[index].trimmed();
+                if (trimmed == u"set" || trimmed == u"new" || trimmed == u"get" || trimmed == u"events?") {
+                    result.action = trimmed.toString();
                     index++;
-                    if (trimmed == "events?") {
+                    if (trimmed == u"events?") {
                         state = Done;
                     } else {
                         state = ExpectName;
                     }
                 } else {
-                    result.action = trimmed;
-                    result.error = "Unknown action: " + trimmed;
+                    result.action = trimmed.toString();
+                    result.error = "Unknown action: " + result.action;
                     state = Error;
                 }
             } else {
@@ -84,8 +315,12 @@ Request RequestParser::parseSingle(const QStringList &tokens, int &index)
 
             break;
         case ExpectName:
+            if (needsMoreInput(index)) {
+                return result;
+            }
+
             if (index < tokens.size() - 1) {
-                result.name = tokens[index];
+                result.name = tokens[index].toString();
                 index++;
                 state = ExpectProp;
             } else {
@@ -95,12 +330,16 @@ Request RequestParser::parseSingle(const QStringList &tokens, int &index)
 
             break;
         case ExpectProp:
+            if (needsMoreInput(index)) {
+                return result;
+            }
+
             if (index < tokens.size() - 1) {
-                result.prop = tokens[index];
+                result.prop = tokens[index].toString();
                 index++;
 
                 if (result.action == "get") {
-                    state = Done;
+                    state = ExpectRange;
                 } else {
                     state = ExpectValue;
                 }
@@ -111,18 +350,22 @@ Request RequestParser::parseSingle(const QStringList &tokens, int &index)
 
             break;
         case ExpectValue:
+            if (needsMoreInput(index)) {
+                return result;
+            }
+
             if (index < tokens.size() - 1) {
                 valueAccum = tokens[index];
                 index++;
-                if (result.prop.startsWith("Entire")) {
-                    if (valueAccum.contains("\n")) {
+                if (hasListValue(result.prop)) {
+                    if (valueAccum.contains(u'\n')) {
                         result.error = "No line breaks in values from Entire-Property";
                         state = Error;
                     } else {
                         state = CollectExtraValue;
                     }
                 } else {
-                    result.value = valueAccum;
+                    result.value = valueAccum.toString();
                     state = Done;
                 }
             } else {
@@ -130,17 +373,41 @@ Request RequestParser::parseSingle(const QStringList &tokens, int &index)
                 state = Error;
             }
 
+            break;
+        case ExpectRange:
+            // Optional part of a get: offset,length
+            if (needsMoreInput(index)) {
+                return result;
+            }
+
+            if (index < tokens.size() - 1 && isRange(tokens[index])) {
+                result.value = tokens[index].toString();
+                index++;
+            }
+            state = Done;
+
             break;
         case CollectExtraValue:
+            // All views point into the same input, so the value including
+            // its separators is simply the span from first to last token
             while (index < tokens.size()) {
-                QString t = tokens[index];
-                if (t.trimmed().isEmpty() || t.contains("\n")) {
+                QStringView t = tokens[index];
+
+                // more items of the list may still follow
+                if (! t.contains(u'\n') && needsMoreInput(index)) {
+                    if (partialValue) {
+                        *partialValue = valueAccum;
+                    }
+                    return result;
+                }
+
+                if (t.trimmed().isEmpty() || t.contains(u'\n')) {
                     break;
                 }
-                valueAccum += "`" + t;
+                valueAccum = QStringView(valueAccum.data(), t.data() + t.size() - valueAccum.data());
                 index++;
             }
-            result.value = valueAccum;
+            result.value = valueAccum.toString();
             state = Done;
 
             break;
@@ -5,6 +5,7 @@
 #define REQUESTPARSER_H
 
 #include <QObject>
+#include <QStringDecoder>
 #include "request.h"
 
 
@@ -14,9 +15,31 @@ class RequestParser : public QObject
 public:
     QList<Request> parseAll(const QString &input);
 
+    // Incremental parsing of input that arrives in pieces
+    QList<Request> feed(const QByteArray &bytes);
+    QList<Request> finish();
+    void reset();
+    void stop();
+
+    static QString takeRequestId(QString &message);
+    static QString tagWithRequestId(const QString &reply, const QString &requestId);
+    static bool hasListValue(const QString &prop);
+
 private:
-    Request parseSingle(const QStringList &tokens, int &index);
+    Request parseSingle(const QList<QStringView> &tokens, int &index, bool *incomplete = nullptr,
+                        QStringView *partialValue = nullptr);
+    bool continueListValue(QList<Request> &parsedRequests);
+
+    QStringDecoder decoder{QStringDecoder::Utf8};
+    QString pendingText;
+    bool stopped = false;
 
+    // An unfinished list value (e.g. a huge EntireTexts) is not tokenized
+    // again with every piece: its request waits here, valueStart is where
+    // the value begins in pendingText and scanPos where to go on scanning
+    Request listValueRequest;
+    qsizetype valueStart = -1;
+    qsizetype scanPos = 0;
 };
 
 #endif // REQUESTPARSER_H
@@ -2,13 +2,19 @@
 // Copyright (c) 2025 Stefan Stechert
 
 #include "server.h"
+#include "requestparser.h"
 
-Server::Server(const AppConfig &config, QObject *parent) : QObject(parent)
+Server::Server(const AppConfig &config, QObject *parent)
+    : QObject(parent), server(this), pushServer(this)
 {
     ip = config.ip;
     port = config.port;
+    pushPort = config.pushPort;
+    maxClients = config.maxClients;
+    framed = config.framed;
 
     connect(&server, &QTcpServer::newConnection, this, &Server::newConnection);
+    connect(&pushServer, &QTcpServer::newConnection, this, &Server::newPushConnection);
 }
 
 
@@ -20,33 +26,38 @@ void Server::start()
     }
 
     qInfo() << "Listening...";
+
+    // Optional second channel: events are written to it as they happen
+    if (pushPort != 0) {
+        if (!pushServer.listen(QHostAddress::AnyIPv4, pushPort)) {
+            qWarning() << pushServer.errorString();
+            return;
+        }
+
+        qInfo() << "Listening for event subscription...";
+    }
 }
 
 
 void Server::quit()
 {
-    if (socket) {
-        disconnect(socket, nullptr, this, nullptr);
-
-        if (socket->state() == QAbstractSocket::ConnectedState) {
-            socket->disconnectFromHost();
-        }
-
-        if (socket->state() != QAbstractSocket::UnconnectedState) {
-            socket->waitForDisconnected(1000);
-        }
+    for (ClientConnection* c : std::as_const(clients)) {
+        c->disconnectFromClient(1000);
+    }
+    clients.clear();
 
-        socket->deleteLater();
-        socket = nullptr;
+    for (ClientConnection* c : std::as_const(pushClients)) {
+        c->disconnectFromClient(1000);
     }
+    pushClients.clear();
+
     server.close();
+    pushServer.close();
 }
 
 
-void Server::newConnection()
+bool Server::isAllowedPeer(QTcpSocket *newSocket)
 {
-    QTcpSocket* newSocket = server.nextPendingConnection();
-
     QString peerIp = newSocket->peerAddress().toString();
 
     // if IPv4-mapped, strip IPv6 prefix
@@ -55,62 +66,143 @@ void Server::newConnection()
     }
 
     if (peerIp == ip) {
-        if (socket) {
-            socket->disconnectFromHost();
-            socket->deleteLater();
-        }
+        qInfo() << "Connected:" << peerIp;
+        return true;
+    }
 
-        socket = newSocket;
-        connect(socket, &QTcpSocket::readyRead, this, &Server::readyRead);
-        connect(socket, &QTcpSocket::disconnected, this, &Server::disconnected);
+    qInfo() << "Connection refused:" << peerIp;
+    newSocket->disconnectFromHost();
+    newSocket->deleteLater();
 
-        qInfo() << "Connected:" << peerIp;
-    } else {
-        qInfo() << "Connection refused:" << peerIp;
-        newSocket->disconnectFromHost();
-        newSocket->deleteLater();
+    return false;
+}
+
+
+// Up to maxClients are served at once. Beyond that the oldest one is
+// dropped, so with the default of 1 a new client replaces the old one.
+void Server::addClient(QList<ClientConnection*> &list, ClientConnection *newClient)
+{
+    while (list.size() >= maxClients) {
+        ClientConnection* oldest = list.takeFirst();
+        disconnect(oldest, nullptr, this, nullptr);
+        oldest->disconnectFromClient();
+    }
+
+    list.append(newClient);
+}
+
+
+void Server::newConnection()
+{
+    QTcpSocket* newSocket = server.nextPendingConnection();
+
+    if (isAllowedPeer(newSocket)) {
+        ClientConnection* client = new ClientConnection(newSocket, framed, this);
+        addClient(clients, client);
+
+        connect(client, &ClientConnection::messageReceived, this, &Server::messageReceived);
+        connect(client, &ClientConnection::requestsReceived, this, &Server::requestsReceived);
+        connect(client, &ClientConnection::disconnected, this, &Server::disconnected);
     }
 }
 
 
 void Server::disconnected()
 {
-    QTcpSocket* s = qobject_cast<QTcpSocket*>(sender());
-    if (!s) {
+    ClientConnection* c = qobject_cast<ClientConnection*>(sender());
+    if (!c) {
         return;
     }
 
-    qInfo() << "Disconnected:" << s->peerAddress().toString();
+    qInfo() << "Disconnected:" << c->peerName();
+
+    clients.removeOne(c);
+    c->deleteLater();
+}
 
-    if (s == socket) {
-        socket = nullptr;
+
+void Server::messageReceived(const QString &message, const QString &requestId)
+{
+    ClientConnection* c = qobject_cast<ClientConnection*>(sender());
+    if (!c || !clients.contains(c)) {
+        return;
     }
 
-    s->deleteLater();
+    pendingReplies.enqueue({c, requestId});
+    emit messageFromClientReceived(message, true);
 }
 
 
-void Server::readyRead()
+void Server::requestsReceived(const QList<Request> &requests, const QString &requestId)
 {
-    QTcpSocket* s = qobject_cast<QTcpSocket*>(sender());
-    if (!s || s != socket) {
+    ClientConnection* c = qobject_cast<ClientConnection*>(sender());
+    if (!c || !clients.contains(c)) {
         return;
     }
 
-    QByteArray receivedBytes = s->readAll();
-    QString message = QString::fromUtf8(receivedBytes);
-
-    emit messageFromClientReceived(message, true);
+    pendingReplies.enqueue({c, requestId});
+    emit requestsFromClientReceived(requests, true);
 }
 
 
 void Server::sendReplyToClient(const QString &message)
 {
-    if (!socket.isNull() && socket->state() == QAbstractSocket::ConnectedState) {
-        socket->write(message.toUtf8());
-        socket->flush();
+    if (pendingReplies.isEmpty()) {
+        qWarning() << "No pending request for this reply.";
+        return;
+    }
+
+    PendingReply pending = pendingReplies.dequeue();
+
+    // The client may have gone in the meantime, then the reply is dropped
+    if (pending.client) {
+        pending.client->send(RequestParser::tagWithRequestId(message, pending.requestId));
     } else {
         qWarning() << "No valid socket to send reply.";
     }
 }
 
+
+void Server::newPushConnection()
+{
+    QTcpSocket* newSocket = pushServer.nextPendingConnection();
+
+    if (isAllowedPeer(newSocket)) {
+        bool wasSubscribed = !pushClients.isEmpty();
+
+        // The push channel is one-way, anything the client sends is ignored
+        ClientConnection* pushClient = new ClientConnection(newSocket, framed, this);
+        addClient(pushClients, pushClient);
+        connect(pushClient, &ClientConnection::disconnected, this, &Server::pushDisconnected);
+
+        if (!wasSubscribed) {
+            emit eventSubscriptionChanged(true);
+        }
+    }
+}
+
+
+void Server::pushDisconnected()
+{
+    ClientConnection* c = qobject_cast<ClientConnection*>(sender());
+    if (!c) {
+        return;
+    }
+
+    qInfo() << "Event subscriber disconnected:" << c->peerName();
+
+    if (pushClients.removeOne(c) && pushClients.isEmpty()) {
+        emit eventSubscriptionChanged(false);
+    }
+
+    c->deleteLater();
+}
+
+
+// Every subscriber gets every event
+void Server::pushEventsToClient(const QString &events)
+{
+    for (ClientConnection* c : std::as_const(pushClients)) {
+        c->send(events);
+    }
+}
@@ -7,8 +7,11 @@
 #include <QTcpServer>
 #include <QTcpSocket>
 #include <QPointer>
+#include <QQueue>
+#include <QList>
 
 #include "appconfig.h"
+#include "clientconnection.h"
 
 class Server : public QObject
 {
@@ -18,24 +21,38 @@ public:
 
 signals:
     void messageFromClientReceived(const QString& message, bool replyExpected);
+    void requestsFromClientReceived(const QList<Request>& requests, bool replyExpected);
+    void eventSubscriptionChanged(bool subscribed);
 
 public slots:
     void start();
     void quit();
     void newConnection();
     void disconnected();
-    void readyRead();
+    void messageReceived(const QString& message, const QString& requestId);
+    void requestsReceived(const QList<Request>& requests, const QString& requestId);
+    void newPushConnection();
+    void pushDisconnected();
 
     void sendReplyToClient(const QString& message);
+    void pushEventsToClient(const QString& events);
 
 private:
+    bool isAllowedPeer(QTcpSocket *newSocket);
+    void addClient(QList<ClientConnection*> &list, ClientConnection *newClient);
+
     QTcpServer server;
+    QTcpServer pushServer;
 
-    //QTcpSocket *socket = nullptr;
-    QPointer<QTcpSocket> socket;
+    QList<ClientConnection*> clients;
+    QList<ClientConnection*> pushClients;
+    QQueue<PendingReply> pendingReplies;
 
     quint16 port;
+    quint16 pushPort;
+    int maxClients;
     QString ip;
+    bool framed;
 };
 
 #endif // SERVER_H
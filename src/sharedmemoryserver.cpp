@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "sharedmemoryserver.h"
+#include "requestparser.h"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+
+namespace {
+constexpr quint32 shmMagic = 0x5047534D;
+constexpr quint32 ringSize = 4 * 1024 * 1024;
+
+constexpr int offMagic = 0;
+constexpr int offRingSize = 4;
+constexpr int offRequestWritePos = 64;
+constexpr int offRequestReadPos = 128;
+constexpr int offReplyWritePos = 192;
+constexpr int offReplyReadPos = 256;
+constexpr int offRequestData = 320;
+constexpr int offReplyData = offRequestData + ringSize;
+constexpr int segmentSize = offReplyData + ringSize;
+
+// Polling slows down step by step while nothing happens: 1 ms while
+// busy, 10 ms after half a second and 100 ms after a few seconds
+constexpr int idleTicksToSlow = 500;
+constexpr int idleTicksToSleep = idleTicksToSlow + 300;
+
+std::atomic<quint32> *atomicAt(void *base, int offset)
+{
+    return reinterpret_cast<std::atomic<quint32>*>(static_cast<char*>(base) + offset);
+}
+}
+
+
+SharedMemoryServer::SharedMemoryServer(const AppConfig &config, QObject *parent)
+    : QObject(parent), sharedMemory(this), pollTimer(this)
+{
+    sharedMemory.setNativeKey(config.shmKey);
+
+    // Fast polling while requests come in, relaxed after some idle time
+    pollTimer.setTimerType(Qt::PreciseTimer);
+    pollTimer.setInterval(1);
+
+    connect(&pollTimer, &QTimer::timeout, this, &SharedMemoryServer::poll);
+}
+
+
+void SharedMemoryServer::start()
+{
+    // A crashed instance may have left its segment behind (Unix only)
+    if (sharedMemory.attach()) {
+        sharedMemory.detach();
+    }
+
+    if (!sharedMemory.create(segmentSize)) {
+        qWarning() << sharedMemory.errorString();
+        return;
+    }
+
+    void *base = sharedMemory.data();
+    std::memset(base, 0, offRequestData);
+    *reinterpret_cast<quint32*>(static_cast<char*>(base) + offRingSize) = ringSize;
+
+    requestRing = ShmRing(base, offRequestWritePos, offRequestReadPos, offRequestData, ringSize);
+    replyRing = ShmRing(base, offReplyWritePos, offReplyReadPos, offReplyData, ringSize);
+    requestRing.initPositions();
+    replyRing.initPositions();
+
+    new (static_cast<char*>(base) + offMagic) std::atomic<quint32>(0);
+    atomicAt(base, offMagic)->store(shmMagic, std::memory_order_release);
+
+    pollTimer.start();
+    qInfo() << "Shared memory ready:" << sharedMemory.nativeKey();
+}
+
+
+void SharedMemoryServer::quit()
+{
+    pollTimer.stop();
+
+    if (sharedMemory.isAttached()) {
+        atomicAt(sharedMemory.data(), offMagic)->store(0, std::memory_order_release);
+        sharedMemory.detach();
+    }
+}
+
+
+void SharedMemoryServer::poll()
+{
+    bool active = readRequestRing();
+    active = writeReplyRing() || active;
+
+    if (active) {
+        idleTicks = 0;
+        pollTimer.setInterval(1);
+
+    } else if (idleTicks < idleTicksToSleep) {
+        idleTicks++;
+
+        if (idleTicks == idleTicksToSlow) {
+            pollTimer.setInterval(10);
+        } else if (idleTicks == idleTicksToSleep) {
+            pollTimer.setInterval(100);
+        }
+    }
+}
+
+
+bool SharedMemoryServer::readRequestRing()
+{
+    QByteArray receivedBytes = requestRing.readAll();
+
+    if (receivedBytes.isEmpty()) {
+        return false;
+    }
+
+    framer.append(receivedBytes);
+
+    QByteArray payload;
+    while (framer.takeMessage(payload)) {
+        QString message = QString::fromUtf8(payload);
+        QString requestId = RequestParser::takeRequestId(message);
+
+        // Replies are prepared in the order of the requests
+        pendingRequestIds.enqueue(requestId);
+        emit messageFromClientReceived(message, true);
+    }
+
+    // The stream position is lost: drop everything unread and start over
+    // with the next frame the client writes
+    if (framer.hasError()) {
+        qWarning() << "Invalid frame header in shared memory, dropping pending request bytes.";
+        requestRing.skipAll();
+        framer.clear();
+    }
+
+    return true;
+}
+
+
+bool SharedMemoryServer::writeReplyRing()
+{
+    const qsizetype pendingCount = pendingReplyBytes.size() - pendingReplyPos;
+
+    if (pendingCount == 0) {
+        return false;
+    }
+
+    // Big replies are written piece by piece, as the client makes room
+    const quint32 count = replyRing.write(pendingReplyBytes.constData() + pendingReplyPos,
+                                          quint32(qMin<qsizetype>(pendingCount, ringSize)));
+
+    if (count == 0) {
+        return false;
+    }
+
+    pendingReplyPos += count;
+
+    if (pendingReplyPos == pendingReplyBytes.size()) {
+        pendingReplyBytes.clear();
+        pendingReplyPos = 0;
+    }
+
+    return true;
+}
+
+
+void SharedMemoryServer::sendReplyToClient(const QString &message)
+{
+    QString requestId;
+    if ( ! pendingRequestIds.isEmpty()) {
+        requestId = pendingRequestIds.dequeue();
+    }
+
+    if ( ! sharedMemory.isAttached()) {
+        qWarning() << "No shared memory to send reply.";
+        return;
+    }
+
+    // Written bytes are dropped lazily, like in MessageFramer::append()
+    if (pendingReplyPos > 0 && pendingReplyPos >= pendingReplyBytes.size() / 2) {
+        pendingReplyBytes.remove(0, pendingReplyPos);
+        pendingReplyPos = 0;
+    }
+
+    pendingReplyBytes.append(MessageFramer::frame(RequestParser::tagWithRequestId(message, requestId).toUtf8()));
+    writeReplyRing();
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef SHAREDMEMORYSERVER_H
+#define SHAREDMEMORYSERVER_H
+
+#include <QObject>
+#include <QSharedMemory>
+#include <QTimer>
+#include <QQueue>
+
+#include "appconfig.h"
+#include "messageframer.h"
+#include "shmring.h"
+
+// Requests and replies travel through two single-producer/single-consumer
+// ring buffers in one shared memory segment, no syscall per message.
+// The byte stream in both rings is framed like --framing=length.
+//
+// Layout of the segment (all integers 32 bit, native byte order):
+//   0    magic "PGSM" (0x5047534D), written last when the segment is ready
+//   4    size of each ring in bytes (power of two)
+//   64   request ring write position   (written by client)
+//   128  request ring read position    (written by PeasyGUI)
+//   192  reply ring write position     (written by PeasyGUI)
+//   256  reply ring read position      (written by client)
+//   320  request ring data, followed by the reply ring data
+// Positions only grow (wrapping at 2^32), the byte offset is pos % size.
+// Both rings are ShmRing (shmring.h).
+//
+// If a frame header in the request ring is invalid, PeasyGUI drops all
+// request bytes written so far and waits for the next frame, so a client
+// has to write its frames as a whole to resynchronise.
+class SharedMemoryServer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SharedMemoryServer(const AppConfig &config, QObject *parent = nullptr);
+
+signals:
+    void messageFromClientReceived(const QString& message, bool replyExpected);
+
+public slots:
+    void start();
+    void quit();
+    void sendReplyToClient(const QString& message);
+
+private slots:
+    void poll();
+
+private:
+    bool readRequestRing();
+    bool writeReplyRing();
+
+    QSharedMemory sharedMemory;
+    QTimer pollTimer;
+    ShmRing requestRing;
+    ShmRing replyRing;
+    MessageFramer framer;
+    QQueue<QString> pendingRequestIds;
+
+    // Written from pendingReplyPos on, dropped once written completely
+    QByteArray pendingReplyBytes;
+    qsizetype pendingReplyPos = 0;
+
+    int idleTicks = 0;
+};
+
+#endif // SHAREDMEMORYSERVER_H
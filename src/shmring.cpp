@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#include "shmring.h"
+
+#include <cstring>
+#include <new>
+
+static_assert(std::atomic<quint32>::is_always_lock_free, "Lock-free atomics needed in shared memory");
+
+ShmRing::ShmRing(void *base, int offWritePos, int offReadPos, int offData, quint32 size)
+    : writePos(reinterpret_cast<std::atomic<quint32>*>(static_cast<char*>(base) + offWritePos)),
+      readPos(reinterpret_cast<std::atomic<quint32>*>(static_cast<char*>(base) + offReadPos)),
+      data(static_cast<char*>(base) + offData),
+      size(size)
+{
+}
+
+
+// Only by the creator of the segment, before anybody else uses it
+void ShmRing::initPositions()
+{
+    writePos = new (writePos) std::atomic<quint32>(0);
+    readPos = new (readPos) std::atomic<quint32>(0);
+}
+
+
+QByteArray ShmRing::readAll()
+{
+    const quint32 write = writePos->load(std::memory_order_acquire);
+    const quint32 read = readPos->load(std::memory_order_relaxed);
+    const quint32 count = write - read;
+
+    if (count == 0) {
+        return QByteArray();
+    }
+
+    const quint32 start = read % size;
+    const quint32 firstPart = qMin(count, size - start);
+
+    QByteArray bytes(data + start, firstPart);
+    bytes.append(data, count - firstPart);
+
+    readPos->store(read + count, std::memory_order_release);
+
+    return bytes;
+}
+
+
+// Everything written so far is dropped unread
+void ShmRing::skipAll()
+{
+    readPos->store(writePos->load(std::memory_order_acquire), std::memory_order_release);
+}
+
+
+quint32 ShmRing::write(const char *bytes, quint32 count)
+{
+    const quint32 write = writePos->load(std::memory_order_relaxed);
+    const quint32 read = readPos->load(std::memory_order_acquire);
+
+    count = qMin(count, size - (write - read));
+
+    if (count == 0) {
+        return 0;
+    }
+
+    const quint32 start = write % size;
+    const quint32 firstPart = qMin(count, size - start);
+
+    std::memcpy(data + start, bytes, firstPart);
+    std::memcpy(data, bytes + firstPart, count - firstPart);
+
+    writePos->store(write + count, std::memory_order_release);
+
+    return count;
+}
+
+
+quint32 ShmRing::available() const
+{
+    return writePos->load(std::memory_order_acquire) - readPos->load(std::memory_order_acquire);
+}
+
+
+quint32 ShmRing::freeSpace() const
+{
+    return size - available();
+}
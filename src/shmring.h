@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Stefan Stechert
+
+#ifndef SHMRING_H
+#define SHMRING_H
+
+#include <QByteArray>
+
+#include <atomic>
+
+// One single-producer/single-consumer byte ring inside shared memory.
+// The write and read positions only grow (wrapping at 2^32), the byte
+// offset in the data is pos % size, so size must be a power of two.
+// Each side only stores its own position: the producer the write
+// position, the consumer the read position.
+class ShmRing
+{
+public:
+    ShmRing() = default;
+    ShmRing(void *base, int offWritePos, int offReadPos, int offData, quint32 size);
+
+    void initPositions();
+
+    // Consumer side
+    QByteArray readAll();
+    void skipAll();
+
+    // Producer side: returns how many bytes fit in, the rest has to wait
+    quint32 write(const char *bytes, quint32 count);
+
+    quint32 available() const;
+    quint32 freeSpace() const;
+
+private:
+    std::atomic<quint32> *writePos = nullptr;
+    std::atomic<quint32> *readPos = nullptr;
+    char *data = nullptr;
+    quint32 size = 0;
+};
+
+#endif // SHMRING_H
@@ -5,22 +5,23 @@
 
 Slider::Slider(QWidget *parent) : QSlider(parent), Control(parent)
 {
-
+    pendingMovedTimer.setSingleShot(true);
+    connect(&pendingMovedTimer, &QTimer::timeout, this, &Slider::emitMoved);
 }
 
 
-void Slider::setSpecificProp(const QString &prop, const QString &value)
+void Slider::setSpecificProp(PropId prop, const QString &value)
 {
-    if (prop == "Value") {
+    if (prop == PropId::Value) {
         this->setSliderPosition(value.toInt());
 
-    } else if (prop == "Min") {
+    } else if (prop == PropId::Min) {
         this->setMinimum(value.toInt());
 
-    } else if (prop == "Max") {
+    } else if (prop == PropId::Max) {
         this->setMaximum(value.toInt());
 
-    } else if (prop == "Orientation") {
+    } else if (prop == PropId::Orientation) {
         if (value == "Horizontal") {
             this->setOrientation(Qt::Horizontal);
 
@@ -28,24 +29,28 @@ void Slider::setSpecificProp(const QString &prop, const QString &value)
             this->setOrientation(Qt::Vertical);
 
         }
+
+    } else if (prop == PropId::MaxEventRate) {
+        maxEventRate = qMax(0, value.toInt());
+
     }
 }
 
 
-QString Slider::getSpecificProp(const QString &prop)
+QString Slider::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Value") {
+    if (prop == PropId::Value) {
         value = QString::number(this->sliderPosition());
 
-    } else if (prop == "Min") {
+    } else if (prop == PropId::Min) {
         value = QString::number(this->minimum());
 
-    } else if (prop == "Max") {
+    } else if (prop == PropId::Max) {
         value = QString::number(this->maximum());
 
-    } else if (prop == "Orientation") {
+    } else if (prop == PropId::Orientation) {
         if (this->orientation() == Qt::Horizontal) {
             value = "Horizontal";
 
@@ -54,26 +59,55 @@ QString Slider::getSpecificProp(const QString &prop)
 
         }
 
+    } else if (prop == PropId::MaxEventRate) {
+        value = QString::number(maxEventRate);
+
     }
 
     return value;
 }
 
 
+// With MaxEventRate, moves within the interval are not sent one by one.
+// A timer sends the position at the end of the interval instead.
 void Slider::mouseMoveEvent(QMouseEvent *ev)
 {
-    if (propsDict["Events"].contains("Moved")) {
-        emit sliderEvent(propsDict["Name"], "Moved`" + QString::number(this->sliderPosition()));
+    QSlider::mouseMoveEvent(ev);
+
+    if ( ! hasEvent(ControlEvent::Moved)) {
+        return;
     }
 
-    QSlider::mouseMoveEvent(ev);
+    if (maxEventRate <= 0) {
+        emitMoved();
+        return;
+    }
+
+    qint64 interval = 1000 / maxEventRate;
+    qint64 elapsed = lastMovedTimer.isValid() ? lastMovedTimer.elapsed() : interval;
+
+    if (elapsed >= interval) {
+        emitMoved();
+
+    } else if ( ! pendingMovedTimer.isActive()) {
+        pendingMovedTimer.start(int(interval - elapsed));
+    }
+}
+
+
+void Slider::emitMoved()
+{
+    pendingMovedTimer.stop();
+    lastMovedTimer.start();
+
+    emit sliderEvent(propSlots[PropId::Name], "Moved`" + QString::number(this->sliderPosition()));
 }
 
 
 void Slider::mousePressEvent(QMouseEvent *ev)
 {
-    if (propsDict["Events"].contains("Pressed")) {
-        emit sliderEvent(propsDict["Name"], "Pressed`" + QString::number(this->sliderPosition()));
+    if (hasEvent(ControlEvent::Pressed)) {
+        emit sliderEvent(propSlots[PropId::Name], "Pressed`" + QString::number(this->sliderPosition()));
     }
 
     QSlider::mousePressEvent(ev);
@@ -82,8 +116,13 @@ void Slider::mousePressEvent(QMouseEvent *ev)
 
 void Slider::mouseReleaseEvent(QMouseEvent *ev)
 {
-    if (propsDict["Events"].contains("Released")) {
-        emit sliderEvent(propsDict["Name"], "Released`" + QString::number(this->sliderPosition()));
+    // The final position comes before Released
+    if (pendingMovedTimer.isActive()) {
+        emitMoved();
+    }
+
+    if (hasEvent(ControlEvent::Released)) {
+        emit sliderEvent(propSlots[PropId::Name], "Released`" + QString::number(this->sliderPosition()));
     }
 
     QSlider::mouseReleaseEvent(ev);
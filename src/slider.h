@@ -5,6 +5,8 @@
 #define SLIDER_H
 
 #include <QSlider>
+#include <QTimer>
+#include <QElapsedTimer>
 #include "control.h"
 
 class Slider : public QSlider, public Control
@@ -14,8 +16,8 @@ class Slider : public QSlider, public Control
 public:
     explicit Slider(QWidget *parent = 0);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 signals:
     void sliderEvent(const QString &name, const QString &event);
@@ -25,6 +27,12 @@ protected:
     void mousePressEvent(QMouseEvent *ev) override;
     void mouseReleaseEvent(QMouseEvent *ev) override;
 
+private:
+    void emitMoved();
+
+    QTimer pendingMovedTimer;
+    QElapsedTimer lastMovedTimer;
+    int maxEventRate = 0;
 };
 
 #endif // SLIDER_H
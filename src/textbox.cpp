@@ -14,19 +14,19 @@ TextBox::TextBox(QWidget *parent) : QPlainTextEdit(parent), Control(parent)
 }
 
 
-void TextBox::setSpecificProp(const QString& prop, const QString& value)
+void TextBox::setSpecificProp(PropId prop, const QString& value)
 {
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         this->setPlainText(value);
     }
 }
 
 
-QString TextBox::getSpecificProp(const QString& prop)
+QString TextBox::getSpecificProp(PropId prop)
 {
     QString value;
 
-    if (prop == "Text") {
+    if (prop == PropId::Text) {
         value = this->toPlainText();
     }
 
@@ -39,10 +39,10 @@ void TextBox::processTextBoxContent()
     int countOfReturns = this->toPlainText().count(QLatin1Char('\n'));
 
     if (countOfReturns > lastCountOfReturns) {
-        if (propsDict["Events"].contains("ReturnPressed")) {
-            emit textBoxEvent(propsDict["Name"], "ReturnPressed");
+        if (hasEvent(ControlEvent::ReturnPressed)) {
+            emit textBoxEvent(propSlots[PropId::Name], "ReturnPressed");
         }
-        if (propsDict["MultiLine"] == "False") {
+        if (propSlots[PropId::MultiLine] == "False") {
             // without blockSignals a endless loop would lead to recursion resulting in a crash
             this->blockSignals(true);
             this->setPlainText(this->toPlainText().replace("\n", ""));
@@ -16,8 +16,8 @@ class TextBox : public QPlainTextEdit, public Control
 public:
     explicit TextBox(QWidget *parent = 0);
 
-    void setSpecificProp(const QString& prop, const QString& value) override;
-    QString getSpecificProp(const QString& prop) override;
+    void setSpecificProp(PropId prop, const QString& value) override;
+    QString getSpecificProp(PropId prop) override;
 
 signals:
     void textBoxEvent(const QString &name, const QString &event);
@@ -303,6 +303,8 @@ void ToolBoxWin::showIntPage(const CollectedProp& p)
 
         if (ruleParts[i].trimmed() == "U") {
             spinBox->setMinimum(0);
+        } else if (ruleParts[i].trimmed() == "P") {
+            spinBox->setMinimum(1);
         } else {
             spinBox->setMinimum(INT_MIN);
         }
@@ -16,8 +16,8 @@ public:
         return propsDict[prop];
     }
 
-    void setSpecificProp(const QString& prop, const QString& value) override {};
-    QString getSpecificProp(const QString& prop) override {return "";};
+    void setSpecificProp(PropId prop, const QString& value) override {};
+    QString getSpecificProp(PropId prop) override {return "";};
 
 private:
     QMap<QString, QString> propsDict;
@@ -0,0 +1,124 @@
+#include <QObject>
+#include <QTest>
+
+#include "../src/binaryrequestcodec.h"
+
+class test_binaryrequestcodec : public QObject {
+    Q_OBJECT
+
+private slots:
+    void good_decode_new_set_get_events() {
+        QByteArray payload;
+        BinaryRequestCodec::appendRequestHeader(payload, "42", 4);
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::New, "Slider_0", PropId::Type);
+        BinaryRequestCodec::appendStringValue(payload, "Slider");
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Set, "Slider_0", PropId::Text);
+        BinaryRequestCodec::appendStringValue(payload, "Grüße`mit Backtick");
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Get, "Slider_0", PropId::Value);
+        BinaryRequestCodec::appendNoRange(payload);
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Events);
+
+        QString requestId;
+        QList<Request> requests = BinaryRequestCodec::decode(payload, requestId);
+
+        QCOMPARE(requestId, "42");
+        QCOMPARE(requests.size(), 4);
+        QCOMPARE(requests[0].action, "new");
+        QCOMPARE(requests[0].name, "Slider_0");
+        QCOMPARE(requests[0].prop, "Type");
+        QCOMPARE(requests[0].value, "Slider");
+        QCOMPARE(requests[1].action, "set");
+        QCOMPARE(requests[1].value, "Grüße`mit Backtick");
+        QCOMPARE(requests[2].action, "get");
+        QCOMPARE(requests[2].prop, "Value");
+        QVERIFY(requests[2].value.isEmpty());
+        QCOMPARE(requests[3].action, "events?");
+        QVERIFY(requests[3].error.isEmpty());
+    }
+
+    void good_decode_ints() {
+        QByteArray payload;
+        BinaryRequestCodec::appendRequestHeader(payload, "", 1);
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Set, "Window", PropId::Geometry);
+        BinaryRequestCodec::appendIntsValue(payload, {10, -20, 300, 400});
+
+        QString requestId;
+        QList<Request> requests = BinaryRequestCodec::decode(payload, requestId);
+
+        QVERIFY(requestId.isEmpty());
+        QCOMPARE(requests.size(), 1);
+        QCOMPARE(requests[0].prop, "Geometry");
+        QCOMPARE(requests[0].value, "10,-20,300,400");
+    }
+
+    void good_decode_get_range() {
+        QByteArray payload;
+        BinaryRequestCodec::appendRequestHeader(payload, "", 1);
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Get, "List", PropId::EntireTexts);
+        BinaryRequestCodec::appendRange(payload, 100, 50);
+
+        QString requestId;
+        QList<Request> requests = BinaryRequestCodec::decode(payload, requestId);
+
+        QCOMPARE(requests.size(), 1);
+        QVERIFY(requests[0].error.isEmpty());
+        QCOMPARE(requests[0].action, "get");
+        QCOMPARE(requests[0].prop, "EntireTexts");
+        QCOMPARE(requests[0].value, "100,50");
+    }
+
+    void bad_decode_get_without_range() {
+        QByteArray payload;
+        BinaryRequestCodec::appendRequestHeader(payload, "", 1);
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Get, "List", PropId::EntireTexts);
+
+        QString requestId;
+        QList<Request> requests = BinaryRequestCodec::decode(payload, requestId);
+
+        QCOMPARE(requests.size(), 1);
+        QCOMPARE(requests.last().error, "Range missing");
+    }
+
+    void bad_decode_truncated() {
+        QByteArray payload;
+        BinaryRequestCodec::appendRequestHeader(payload, "", 1);
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Set, "Window", PropId::Text);
+        BinaryRequestCodec::appendStringValue(payload, "Title");
+        payload.chop(2);
+
+        QString requestId;
+        QList<Request> requests = BinaryRequestCodec::decode(payload, requestId);
+
+        QCOMPARE(requests.size(), 1);
+        QCOMPARE(requests.last().error, "Value missing");
+    }
+
+    void bad_decode_unknown_prop_number() {
+        QByteArray payload;
+        BinaryRequestCodec::appendRequestHeader(payload, "", 1);
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Get, "Window", PropId::Unknown);
+        BinaryRequestCodec::appendNoRange(payload);
+
+        QString requestId;
+        QList<Request> requests = BinaryRequestCodec::decode(payload, requestId);
+
+        QVERIFY(requests.last().error.startsWith("Unknown property number"));
+    }
+
+    void bad_decode_trailing_bytes() {
+        QByteArray payload;
+        BinaryRequestCodec::appendRequestHeader(payload, "", 1);
+        BinaryRequestCodec::appendRequest(payload, BinaryRequestCodec::Events);
+        payload.append('x');
+
+        QString requestId;
+        QList<Request> requests = BinaryRequestCodec::decode(payload, requestId);
+
+        QCOMPARE(requests.size(), 2);
+        QVERIFY( ! requests.last().error.isEmpty());
+    }
+};
+
+QTEST_MAIN(test_binaryrequestcodec)
+
+#include "test_binaryrequestcodec.moc"
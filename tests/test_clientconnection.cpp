@@ -0,0 +1,68 @@
+#include <QObject>
+#include <QTest>
+#include <QSignalSpy>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QtEndian>
+
+#include "../src/clientconnection.h"
+
+class test_clientconnection : public QObject {
+    Q_OBJECT
+
+private:
+    QLocalServer server;
+    QLocalSocket *client = nullptr;
+    ClientConnection *connection = nullptr;
+
+    void connectFramed() {
+        client = new QLocalSocket(this);
+        client->connectToServer(server.fullServerName());
+        QVERIFY(client->waitForConnected(1000));
+        QVERIFY(server.waitForNewConnection(1000));
+
+        connection = new ClientConnection(server.nextPendingConnection(), true);
+    }
+
+private slots:
+    void initTestCase() {
+        QString name = "peasygui_test_clientconnection_" + QString::number(QCoreApplication::applicationPid());
+        QLocalServer::removeServer(name);
+        QVERIFY(server.listen(name));
+    }
+
+    void cleanup() {
+        delete client;
+        client = nullptr;
+    }
+
+    void good_framed_first_message() {
+        connectFramed();
+        QSignalSpy spy(connection, &ClientConnection::messageReceived);
+
+        client->write(MessageFramer::frame("get`Window`Text`"));
+        client->flush();
+
+        QTRY_COMPARE(spy.count(), 1);
+        QCOMPARE(spy[0][0].toString(), "get`Window`Text`");
+        delete connection;
+    }
+
+    void bad_oversized_first_header_closes() {
+        connectFramed();
+        QPointer<ClientConnection> guard(connection);
+        QSignalSpy spy(connection, &ClientConnection::disconnected);
+
+        char header[MessageFramer::headerSize];
+        qToBigEndian(MessageFramer::maxPayloadSize + 1, header);
+        client->write(header, sizeof(header));
+        client->flush();
+
+        QTRY_COMPARE(spy.count(), 1);
+        QTRY_VERIFY(guard.isNull());
+    }
+};
+
+QTEST_MAIN(test_clientconnection)
+
+#include "test_clientconnection.moc"
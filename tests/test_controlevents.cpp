@@ -0,0 +1,46 @@
+#include <QObject>
+#include <QTest>
+
+#include "../src/controlevents.h"
+
+class test_controlevents : public QObject {
+    Q_OBJECT
+
+private slots:
+    void good_parse_list() {
+        ControlEvents events = parseControlEvents("Moved,Released");
+
+        QVERIFY(events.testFlag(ControlEvent::Moved));
+        QVERIFY(events.testFlag(ControlEvent::Released));
+        QVERIFY( ! events.testFlag(ControlEvent::Pressed));
+    }
+
+    void good_parse_empty() {
+        QVERIFY(parseControlEvents("") == ControlEvents());
+    }
+
+    void good_double_clicked_is_not_clicked() {
+        ControlEvents events = parseControlEvents("DoubleClicked,SelectionChanged");
+
+        QVERIFY(events.testFlag(ControlEvent::DoubleClicked));
+        QVERIFY( ! events.testFlag(ControlEvent::Clicked));
+    }
+
+    void good_image_view_events() {
+        ControlEvents events = parseControlEvents("ClickedAtPos,ImageLoaded");
+
+        QVERIFY(events.testFlag(ControlEvent::ClickedAtPos));
+        QVERIFY(events.testFlag(ControlEvent::ImageLoaded));
+    }
+
+    void bad_unknown_names_are_ignored() {
+        ControlEvents events = parseControlEvents("Clicked,DoesNotExist, Closed");
+
+        QVERIFY(events.testFlag(ControlEvent::Clicked));
+        QVERIFY(events.testFlag(ControlEvent::Closed));
+    }
+};
+
+QTEST_MAIN(test_controlevents)
+
+#include "test_controlevents.moc"
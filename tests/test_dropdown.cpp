@@ -0,0 +1,65 @@
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include "../src/dropdown.h"
+
+class test_dropdown : public QObject {
+    Q_OBJECT
+
+private slots:
+    void good_empty_entire_texts_means_no_items() {
+        DropDown dropDown;
+        dropDown.setSpecificProp(PropId::EntireTexts, "a`b");
+        dropDown.setSpecificProp(PropId::EntireTexts, "");
+
+        QCOMPARE(dropDown.count(), 0);
+        QCOMPARE(dropDown.getSpecificProp(PropId::ItemCount), "0");
+        QCOMPARE(dropDown.getSpecificProp(PropId::EntireTexts), "");
+    }
+
+    void good_append_insert_replace_remove() {
+        DropDown dropDown;
+        dropDown.setSpecificProp(PropId::EntireTexts, "a`b");
+
+        dropDown.setSpecificProp(PropId::AppendTexts, "c`d");
+        QCOMPARE(dropDown.getSpecificProp(PropId::EntireTexts), "a`b`c`d");
+
+        dropDown.setSpecificProp(PropId::InsertTexts, "1`x`y");
+        QCOMPARE(dropDown.getSpecificProp(PropId::EntireTexts), "a`x`y`b`c`d");
+
+        dropDown.setSpecificProp(PropId::ReplaceTexts, "4`C`D");
+        QCOMPARE(dropDown.getSpecificProp(PropId::EntireTexts), "a`x`y`b`C`D");
+
+        dropDown.setSpecificProp(PropId::RemoveRows, "1,3");
+        QCOMPARE(dropDown.getSpecificProp(PropId::EntireTexts), "a`C`D");
+        QCOMPARE(dropDown.getSpecificProp(PropId::ItemCount), "3");
+    }
+
+    void good_append_to_empty_drop_down() {
+        DropDown dropDown;
+        dropDown.setSpecificProp(PropId::EntireTexts, "");
+        dropDown.setSpecificProp(PropId::AppendTexts, "a");
+
+        QCOMPARE(dropDown.getSpecificProp(PropId::EntireTexts), "a");
+    }
+
+    void good_edits_do_not_signal_a_selection() {
+        DropDown dropDown;
+        dropDown.setSpecificProp(PropId::EntireTexts, "a`b`c");
+        dropDown.setSpecificProp(PropId::Selected, "1");
+
+        QSignalSpy spy(&dropDown, &QComboBox::currentIndexChanged);
+
+        dropDown.setSpecificProp(PropId::InsertTexts, "0`x");
+        dropDown.setSpecificProp(PropId::RemoveRows, "0,3");
+        dropDown.setSpecificProp(PropId::AppendTexts, "d");
+        dropDown.setSpecificProp(PropId::ReplaceTexts, "0`e");
+
+        QCOMPARE(spy.count(), 0);
+    }
+};
+
+QTEST_MAIN(test_dropdown)
+
+#include "test_dropdown.moc"
@@ -0,0 +1,126 @@
+#include <QObject>
+#include <QTest>
+
+#include "../src/eventqueue.h"
+
+class test_eventqueue : public QObject {
+    Q_OBJECT
+
+private slots:
+    void good_empty() {
+        EventQueue queue;
+
+        QVERIFY(queue.isEmpty());
+        QCOMPARE(queue.take(), "");
+    }
+
+    void good_discrete_events_are_kept() {
+        EventQueue queue;
+        queue.append("Button_1", "Clicked");
+        queue.append("Button_1", "Clicked");
+
+        QCOMPARE(queue.size(), 2);
+        QCOMPARE(queue.take(), "Button_1`Clicked`\nButton_1`Clicked`\n");
+        QVERIFY(queue.isEmpty());
+    }
+
+    void good_latest_move_wins() {
+        EventQueue queue;
+        queue.append("Slider_1", "Moved`10");
+        queue.append("Slider_1", "Moved`11");
+        queue.append("Slider_1", "Moved`12");
+
+        QCOMPARE(queue.size(), 1);
+        QCOMPARE(queue.take(), "Slider_1`Moved`12`\n");
+    }
+
+    void good_other_controls_do_not_break_coalescing() {
+        EventQueue queue;
+        queue.append("Slider_1", "Moved`10");
+        queue.append("Button_1", "Clicked");
+        queue.append("Slider_1", "Moved`12");
+
+        QCOMPARE(queue.take(), "Slider_1`Moved`12`\nButton_1`Clicked`\n");
+    }
+
+    void good_order_of_one_control_is_kept() {
+        EventQueue queue;
+        queue.append("Slider_1", "Moved`10");
+        queue.append("Slider_1", "Released`10");
+        queue.append("Slider_1", "Moved`20");
+        queue.append("Slider_1", "Moved`30");
+
+        QCOMPARE(queue.take(), "Slider_1`Moved`10`\nSlider_1`Released`10`\nSlider_1`Moved`30`\n");
+    }
+
+    void good_coalescing_starts_over_after_take() {
+        EventQueue queue;
+        queue.append("Window", "Resized`300,200");
+        queue.take();
+        queue.append("Window", "Resized`310,200");
+
+        QCOMPARE(queue.take(), "Window`Resized`310,200`\n");
+    }
+
+    void good_take_in_chunks() {
+        EventQueue queue;
+        queue.append("Button_1", "Clicked");
+        queue.append("Button_2", "Clicked");
+        queue.append("Button_3", "Clicked");
+
+        QCOMPARE(queue.take(2), "Button_1`Clicked`\nButton_2`Clicked`\n");
+        QCOMPARE(queue.size(), 1);
+        QCOMPARE(queue.take(2), "Button_3`Clicked`\n");
+        QVERIFY(queue.isEmpty());
+    }
+
+    void good_coalescing_after_partial_take() {
+        EventQueue queue;
+        queue.append("Button_1", "Clicked");
+        queue.append("Slider_1", "Moved`10");
+        queue.take(1);
+        queue.append("Slider_1", "Moved`20");
+
+        QCOMPARE(queue.take(), "Slider_1`Moved`20`\n");
+    }
+
+    void bad_overflow_drops_oldest() {
+        EventQueue queue;
+        queue.setCapacity(2);
+        queue.append("Button_1", "Clicked");
+        queue.append("Button_2", "Clicked");
+        queue.append("Button_3", "Clicked");
+
+        QCOMPARE(queue.size(), 2);
+        QCOMPARE(queue.takeDroppedCount(), 1);
+        QCOMPARE(queue.takeDroppedCount(), 0);
+        QCOMPARE(queue.take(), "Button_2`Clicked`\nButton_3`Clicked`\n");
+    }
+
+    void bad_overflow_of_a_long_stall() {
+        EventQueue queue;
+        queue.setCapacity(100);
+
+        for (int i = 0; i < 5000; i++) {
+            queue.append("Button_1", "Clicked`" + QString::number(i));
+        }
+
+        QCOMPARE(queue.size(), 100);
+        QCOMPARE(queue.takeDroppedCount(), 4900);
+        QVERIFY(queue.take(1).startsWith("Button_1`Clicked`4900`"));
+    }
+
+    void bad_smaller_capacity_drops_at_once() {
+        EventQueue queue;
+        queue.append("Button_1", "Clicked");
+        queue.append("Button_2", "Clicked");
+        queue.setCapacity(1);
+
+        QCOMPARE(queue.takeDroppedCount(), 1);
+        QCOMPARE(queue.take(), "Button_2`Clicked`\n");
+    }
+};
+
+QTEST_MAIN(test_eventqueue)
+
+#include "test_eventqueue.moc"
@@ -0,0 +1,43 @@
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include "../src/listbox.h"
+
+class test_listbox : public QObject {
+    Q_OBJECT
+
+private slots:
+    void good_edits_keep_selection_in_step() {
+        ListBox listBox;
+        listBox.setSpecificProp(PropId::EntireTexts, "a`b`c");
+        listBox.setSpecificProp(PropId::Selected, "1");
+
+        listBox.setSpecificProp(PropId::InsertTexts, "0`x");
+        QCOMPARE(listBox.getSpecificProp(PropId::Selected), "2");
+
+        listBox.setSpecificProp(PropId::RemoveRows, "2,1");
+        QCOMPARE(listBox.getSpecificProp(PropId::Selected), "");
+        QCOMPARE(listBox.getSpecificProp(PropId::EntireTexts), "x`a`c");
+    }
+
+    void good_edits_do_not_signal_a_selection() {
+        ListBox listBox;
+        listBox.setSpecificProp(PropId::EntireTexts, "a`b`c");
+        listBox.setSpecificProp(PropId::Selected, "1");
+
+        QSignalSpy spy(listBox.selectionModel(), &QItemSelectionModel::selectionChanged);
+
+        listBox.setSpecificProp(PropId::InsertTexts, "0`x");
+        listBox.setSpecificProp(PropId::ReplaceTexts, "2`B");
+        listBox.setSpecificProp(PropId::AppendTexts, "d");
+        listBox.setSpecificProp(PropId::RemoveRows, "0,3");
+
+        QCOMPARE(spy.count(), 0);
+        QCOMPARE(listBox.getSpecificProp(PropId::Selected), "");
+    }
+};
+
+QTEST_MAIN(test_listbox)
+
+#include "test_listbox.moc"
@@ -0,0 +1,120 @@
+#include <QObject>
+#include <QTest>
+
+#include "../src/listboxmodel.h"
+
+class test_listboxmodel : public QObject {
+    Q_OBJECT
+
+private slots:
+    void good_items_from_entire_texts() {
+        ListBoxModel model;
+        model.setEntireTexts("a`bc`def");
+
+        QCOMPARE(model.rowCount(), 3);
+        QCOMPARE(model.itemText(0), "a");
+        QCOMPARE(model.itemText(1), "bc");
+        QCOMPARE(model.itemText(2), "def");
+        QCOMPARE(model.data(model.index(1)).toString(), "bc");
+        QCOMPARE(model.entireTexts(), "a`bc`def");
+    }
+
+    void good_empty_means_no_items() {
+        ListBoxModel model;
+        QCOMPARE(model.rowCount(), 0);
+
+        model.setEntireTexts("a`b");
+        model.setEntireTexts("");
+
+        QCOMPARE(model.rowCount(), 0);
+        QCOMPARE(model.entireTexts(), "");
+    }
+
+    void good_empty_items() {
+        ListBoxModel model;
+        model.setEntireTexts("`x`");
+
+        QCOMPARE(model.rowCount(), 3);
+        QCOMPARE(model.itemText(0), "");
+        QCOMPARE(model.itemText(1), "x");
+        QCOMPARE(model.itemText(2), "");
+    }
+
+    void good_many_items() {
+        QStringList items;
+        for (int i = 0; i < 100000; i++) {
+            items.append(QString::number(i));
+        }
+
+        ListBoxModel model;
+        model.setEntireTexts(items.join('`'));
+
+        QCOMPARE(model.rowCount(), 100000);
+        QCOMPARE(model.itemText(99999), "99999");
+    }
+
+    void good_append_insert_replace_remove() {
+        ListBoxModel model;
+
+        model.appendTexts("a`b");
+        model.appendTexts("c");
+        QCOMPARE(model.entireTexts(), "a`b`c");
+
+        model.insertTexts(0, "x`y");
+        model.insertTexts(2, "z");
+        QCOMPARE(model.entireTexts(), "x`y`z`a`b`c");
+
+        model.replaceTexts(4, "B`C");
+        QCOMPARE(model.entireTexts(), "x`y`z`a`B`C");
+
+        QVERIFY(model.removeRows(1, 2));
+        QCOMPARE(model.entireTexts(), "x`a`B`C");
+
+        QVERIFY(model.removeRows(2, 2));
+        QCOMPARE(model.entireTexts(), "x`a");
+        QCOMPARE(model.rowCount(), 2);
+        QCOMPARE(model.itemText(1), "a");
+
+        QVERIFY( ! model.removeRows(1, 2));
+        QVERIFY(model.removeRows(0, 2));
+        QCOMPARE(model.rowCount(), 0);
+        QCOMPARE(model.entireTexts(), "");
+    }
+
+    void good_offsets_follow_edits() {
+        ListBoxModel model;
+        model.setEntireTexts("aa`b`ccc");
+
+        model.insertTexts(1, "`X");
+        model.replaceTexts(0, "A");
+
+        QCOMPARE(model.rowCount(), 5);
+        QCOMPARE(model.itemText(0), "A");
+        QCOMPARE(model.itemText(1), "");
+        QCOMPARE(model.itemText(2), "X");
+        QCOMPARE(model.itemText(3), "b");
+        QCOMPARE(model.itemText(4), "ccc");
+    }
+
+    void good_pages_of_rows() {
+        ListBoxModel model;
+        model.setEntireTexts("dog`cat`mouse");
+
+        QCOMPARE(model.textsOfRows(0, 1), "dog");
+        QCOMPARE(model.textsOfRows(1, 2), "cat`mouse");
+        QCOMPARE(model.textsOfRows(2, 10), "mouse");
+        QCOMPARE(model.textsOfRows(3, 10), "");
+    }
+
+    void bad_row_out_of_range() {
+        ListBoxModel model;
+        model.setEntireTexts("a");
+
+        QVERIFY(model.itemText(1).isNull());
+        QVERIFY( ! model.data(model.index(1)).isValid());
+    }
+};
+
+QTEST_MAIN(test_listboxmodel)
+
+#include "test_listboxmodel.moc"
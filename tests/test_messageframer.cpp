@@ -0,0 +1,93 @@
+#include <QObject>
+#include <QTest>
+
+#include "../src/messageframer.h"
+
+class test_messageframer : public QObject {
+    Q_OBJECT
+
+private slots:
+    void good_frame_has_big_endian_header() {
+        QByteArray framed = MessageFramer::frame("events?");
+
+        QCOMPARE(framed.size(), 4 + 7);
+        QCOMPARE(framed.left(4), QByteArray("\x00\x00\x00\x07", 4));
+        QCOMPARE(framed.mid(4), QByteArray("events?"));
+    }
+
+    void good_single_message() {
+        MessageFramer framer;
+        QByteArray payload;
+
+        framer.append(MessageFramer::frame("get`Button_1`Text`"));
+
+        QVERIFY(framer.takeMessage(payload));
+        QCOMPARE(payload, QByteArray("get`Button_1`Text`"));
+        QVERIFY( ! framer.takeMessage(payload));
+    }
+
+    void good_message_split_into_chunks() {
+        MessageFramer framer;
+        QByteArray payload;
+        QByteArray framed = MessageFramer::frame("set`ListBox_1`EntireTexts`A`B`C`");
+
+        framer.append(framed.left(2));
+        QVERIFY( ! framer.takeMessage(payload));
+
+        framer.append(framed.mid(2, 10));
+        QVERIFY( ! framer.takeMessage(payload));
+
+        framer.append(framed.mid(12));
+        QVERIFY(framer.takeMessage(payload));
+        QCOMPARE(payload, QByteArray("set`ListBox_1`EntireTexts`A`B`C`"));
+    }
+
+    void good_multiple_messages_in_one_chunk() {
+        MessageFramer framer;
+        QByteArray payload;
+
+        framer.append(MessageFramer::frame("set`Label_1`Text`A`") +
+                      MessageFramer::frame("set`Label_1`Text`B`") +
+                      MessageFramer::frame("events?").left(6));
+
+        QVERIFY(framer.takeMessage(payload));
+        QCOMPARE(payload, QByteArray("set`Label_1`Text`A`"));
+
+        QVERIFY(framer.takeMessage(payload));
+        QCOMPARE(payload, QByteArray("set`Label_1`Text`B`"));
+
+        QVERIFY( ! framer.takeMessage(payload));
+
+        framer.append("ts?");
+        QVERIFY(framer.takeMessage(payload));
+        QCOMPARE(payload, QByteArray("events?"));
+    }
+
+    void good_empty_message() {
+        MessageFramer framer;
+        QByteArray payload = "not empty";
+
+        framer.append(MessageFramer::frame(""));
+
+        QVERIFY(framer.takeMessage(payload));
+        QVERIFY(payload.isEmpty());
+    }
+
+    void bad_oversized_header() {
+        MessageFramer framer;
+        QByteArray payload;
+
+        framer.append(QByteArray("\xff\xff\xff\xff", 4) + "abc");
+
+        QVERIFY( ! framer.takeMessage(payload));
+        QVERIFY(framer.hasError());
+
+        framer.clear();
+        QVERIFY( ! framer.hasError());
+    }
+
+};
+
+QTEST_MAIN(test_messageframer)
+
+#include "test_messageframer.moc"
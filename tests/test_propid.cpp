@@ -0,0 +1,44 @@
+#include <QObject>
+#include <QTest>
+
+#include "../src/propid.h"
+#include "../src/controlprototypes.h"
+
+class test_propid : public QObject {
+    Q_OBJECT
+
+private slots:
+    void good_name_to_id_and_back() {
+        QVERIFY(propIdFromName("Geometry") == PropId::Geometry);
+        QCOMPARE(propNameOf(PropId::Geometry), "Geometry");
+    }
+
+    void good_numbers_stay_the_same() {
+        // Binary clients send these numbers, see PEASY_PROPS
+        QCOMPARE(int(PropId::Name), 0);
+        QCOMPARE(int(PropId::Geometry), 2);
+        QCOMPARE(int(PropId::EntireTexts), 10);
+        QCOMPARE(int(PropId::Value), 29);
+        QCOMPARE(int(PropId::ItemCount), 40);
+    }
+
+    void bad_unknown_name() {
+        QVERIFY(propIdFromName("DoesNotExist") == PropId::Unknown);
+        QVERIFY(propIdFromName("geometry") == PropId::Unknown);
+    }
+
+    void every_prototype_prop_has_an_id() {
+        const Prototypes& prototypes = getPrototypes();
+
+        for (auto it = prototypes.cbegin(); it != prototypes.cend(); ++it) {
+            for (const PropInfo& propInfo : it.value()) {
+                QVERIFY2(propIdFromName(propInfo.propName) != PropId::Unknown,
+                         qPrintable(it.key() + ": " + propInfo.propName));
+            }
+        }
+    }
+};
+
+QTEST_MAIN(test_propid)
+
+#include "test_propid.moc"
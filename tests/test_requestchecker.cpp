@@ -13,6 +13,7 @@ private:
     MockControl window;
     MockControl listBox;
     QList<Control*> controls;
+    ControlShadow shadow;
     const Prototypes& prototypes = getPrototypes();
 
 private slots:
@@ -30,6 +31,7 @@ private slots:
         listBox.setProp("MultiSelect", "False");
 
         controls << &window << &listBox;
+        shadow = RequestChecker::shadowOfControls(controls);
     }
 
     void good_check_events() {
@@ -71,27 +73,22 @@ private slots:
     }
 
     void good_init_with_2_controls() {
-        QStringList controlNames;
-        QStringList controlTypes;
-        ListBoxTexts listBoxTexts;
-
-        QStringList expectedNames{"MyWindow", "MyListBox"};
+        ControlIndex expectedIndex{{"MyWindow", 0}, {"MyListBox", 1}};
         QStringList expectedTypes{"Window", "ListBox"};
-        ListBoxTexts expectedLBT;
-        expectedLBT[1] = "A`B`C";
+        QHash<int, int> expectedItemCounts{{1, 3}};
 
-        RequestChecker::initializeVirtualsWithExistingControls(controlNames, controlTypes, listBoxTexts, controls);
+        ControlShadow shadow = RequestChecker::shadowOfControls(controls);
 
-        QCOMPARE(controlNames, expectedNames);
-        QCOMPARE(controlTypes, expectedTypes);
-        QCOMPARE(listBoxTexts, expectedLBT);
+        QCOMPARE(shadow.indexByName, expectedIndex);
+        QCOMPARE(shadow.types, expectedTypes);
+        QCOMPARE(shadow.listItemCounts, expectedItemCounts);
     }
 
     void index_of_existing_controlnames() {
         QString result;
-        QStringList controlNames{"MyWindow", "MyListBox"};
+        RequestChecker::VirtualControls virtuals(shadow);
 
-        int index = RequestChecker::getControlIndexByName("MyListBox", controlNames);
+        int index = virtuals.indexOf("MyListBox");
         QCOMPARE(index, 1);
 
         RequestChecker::checkControlExists(result, index);
@@ -103,9 +100,9 @@ private slots:
 
     void no_control_with_this_name() {
         QString result;
-        QStringList controlNames{"MyWindow", "MyListBox"};
+        RequestChecker::VirtualControls virtuals(shadow);
 
-        int index = RequestChecker::getControlIndexByName("DoesNotExist", controlNames);
+        int index = virtuals.indexOf("DoesNotExist");
         QCOMPARE(index, -1);
 
         RequestChecker::checkNewControlNameIsUnique(result, index);
@@ -115,6 +112,24 @@ private slots:
         QCOMPARE(result, "A control with this name could not be found");
     }
 
+    void virtuals_leave_shadow_untouched() {
+        RequestChecker::VirtualControls virtuals(shadow);
+
+        virtuals.rename("MyListBox", "Renamed");
+        virtuals.append("MyListBox", "ListBox");
+        virtuals.setListItemCount(1, 7);
+
+        QCOMPARE(virtuals.indexOf("Renamed"), 1);
+        QCOMPARE(virtuals.indexOf("MyListBox"), 2);
+        QCOMPARE(virtuals.typeOf(2), "ListBox");
+        QCOMPARE(virtuals.listItemCount(1), 7);
+        QCOMPARE(virtuals.listItemCount(2), 0);
+
+        QCOMPARE(shadow.indexByName.value("MyListBox"), 1);
+        QVERIFY( ! shadow.indexByName.contains("Renamed"));
+        QCOMPARE(shadow.listItemCounts.value(1), 3);
+    }
+
     void good_spawn_of_existing_control_type() {
         QString result;
 
@@ -194,47 +209,82 @@ private slots:
     void good_all_indeces_are_in_range() {
         QString result;
 
-        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "0,2", "a`b`c");
+        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "0,2", 3);
         QCOMPARE(result, "");
 
-        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "1,2", "a`b`c");
+        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "1,2", 3);
         QCOMPARE(result, "");
 
-        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "1", "a`b`c");
+        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "1", 3);
         QCOMPARE(result, "");
     }
 
     void good_no_indeces_selected_by_empty() {
         QString result;
 
-        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "", "a`b`c");
+        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "", 3);
         QCOMPARE(result, "");
     }
 
     void bad_indeces_float_and_string() {
         QString result;
 
-        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "1,a", "a`b`c");
+        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "1,a", 3);
         QVERIFY(result.contains("list indeces must be positive integers"));
 
         result = "";
 
-        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "1.0", "a`b`c");
+        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "1.0", 3);
         QVERIFY(result.contains("list indeces must be positive integers"));
     }
 
     void bad_indeces_out_of_range() {
         QString result;
 
-        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "3", "a`b`c");
+        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "3", 3);
         QVERIFY(result.contains("List indeces must be in range"));
 
         result = "";
 
-        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "0", "");
+        RequestChecker::checkIfSelectionIndecesAreInRangeOfItems(result, "0", 0);
         QVERIFY(result.contains("List indeces must be in range"));
     }
 
+    void good_list_edits_in_range() {
+        QString result;
+
+        RequestChecker::checkIfListEditIsInRangeOfItems(result, "3`a`b", "ListInsert", 3);
+        QCOMPARE(result, "");
+
+        RequestChecker::checkIfListEditIsInRangeOfItems(result, "1`a`b", "ListReplace", 3);
+        QCOMPARE(result, "");
+
+        RequestChecker::checkIfListEditIsInRangeOfItems(result, "0,3", "ListRemove", 3);
+        QCOMPARE(result, "");
+    }
+
+    void bad_list_edits_out_of_range() {
+        QString result;
+
+        RequestChecker::checkIfListEditIsInRangeOfItems(result, "4`a", "ListInsert", 3);
+        QVERIFY(result.contains("List rows must be in range"));
+
+        result = "";
+
+        RequestChecker::checkIfListEditIsInRangeOfItems(result, "2`a`b", "ListReplace", 3);
+        QVERIFY(result.contains("List rows must be in range"));
+
+        result = "";
+
+        RequestChecker::checkIfListEditIsInRangeOfItems(result, "2,2", "ListRemove", 3);
+        QVERIFY(result.contains("List rows must be in range"));
+
+        result = "";
+
+        RequestChecker::checkIfListEditIsInRangeOfItems(result, "x`a", "ListInsert", 3);
+        QVERIFY(result.contains("positive integer row"));
+    }
+
     void good_all_in_multi_list() {
         QString result;
 
@@ -277,6 +327,18 @@ private slots:
         QVERIFY(result.contains("Found negative value, where positive is expected"));
     }
 
+    void bad_integers_zero_where_at_least_one() {
+        QString result;
+
+        RequestChecker::checkAllIntegers(result, "0", "Int:P");
+        QVERIFY(result.contains("Found value below 1, where at least 1 is expected"));
+
+        result = "";
+
+        RequestChecker::checkAllIntegers(result, "1", "Int:P");
+        QCOMPARE(result, "");
+    }
+
     void bad_wrong_integer_count() {
         QString result;
 
@@ -325,7 +387,7 @@ private slots:
             Request{"set", "MyWindow", "Events", "Closed,KeyPressed", ""}
         };
 
-        QString result = RequestChecker::checkAll(requests, controls);
+        QString result = RequestChecker::checkAll(requests, shadow);
 
         QVERIFY(result.isEmpty());
     }
@@ -338,17 +400,43 @@ private slots:
             Request{"new", "MyListBox", "Type", "ListBox", ""}
         };
 
-        QString result = RequestChecker::checkAll(requests, controls);
+        QString result = RequestChecker::checkAll(requests, shadow);
 
         QCOMPARE(result, "");
     }
 
+    void good_get_with_range() {
+        QList<Request> requests = {
+            Request{"get", "MyListBox", "EntireTexts", "0,100", ""}
+        };
+
+        QCOMPARE(RequestChecker::checkAll(requests, shadow), "");
+
+        requests[0].value = "0,-1";
+
+        QVERIFY(RequestChecker::checkAll(requests, shadow).contains("negative value"));
+    }
+
+    void good_append_then_select_new_rows() {
+        QList<Request> requests = {
+            Request{"set", "MyListBox", "AppendTexts", "D`E", ""},
+            Request{"set", "MyListBox", "RemoveRows", "0,1", ""},
+            Request{"set", "MyListBox", "Selected", "3", ""}
+        };
+
+        QCOMPARE(RequestChecker::checkAll(requests, shadow), "");
+
+        requests.append(Request{"set", "MyListBox", "Selected", "4", ""});
+
+        QVERIFY(RequestChecker::checkAll(requests, shadow).contains("List indeces must be in range"));
+    }
+
     void bad_check_all_invalid_event_in_list() {
         QList<Request> requests = {
             Request{"set", "MyWindow", "Events", "Closed,InvalidEvent", ""}
         };
 
-        QString result = RequestChecker::checkAll(requests, controls);
+        QString result = RequestChecker::checkAll(requests, shadow);
 
         QVERIFY(result.contains("At least one of the values is not in the list of possibles"));
     }
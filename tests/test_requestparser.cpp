@@ -59,6 +59,47 @@ private slots:
         QCOMPARE(result[0].value, "A`B`C");
     }
 
+    void good_parse_get_with_range() {
+        RequestParser parser;
+        auto result = parser.parseAll("get`ListBox_1`EntireTexts`100,50`\n");
+
+        QCOMPARE(result.size(), 1);
+        QVERIFY(result[0].error.isEmpty());
+        QCOMPARE(result[0].prop, "EntireTexts");
+        QCOMPARE(result[0].value, "100,50");
+    }
+
+    void good_parse_get_followed_by_request_on_same_line() {
+        RequestParser parser;
+        auto result = parser.parseAll("get`A`Text`set`B`Text`x`\n");
+
+        QCOMPARE(result.size(), 2);
+        QVERIFY(result[0].value.isEmpty());
+        QCOMPARE(result[1].action, "set");
+        QCOMPARE(result[1].name, "B");
+        QCOMPARE(result[1].value, "x");
+        QVERIFY(result[1].error.isEmpty());
+
+        result = parser.parseAll("get`A`Text`events?`\n");
+
+        QCOMPARE(result.size(), 2);
+        QVERIFY(result[0].value.isEmpty());
+        QCOMPARE(result[1].action, "events?");
+        QVERIFY(result[1].error.isEmpty());
+    }
+
+    void good_parse_list_edit_values() {
+        RequestParser parser;
+        QString val = "set`ListBox_1`AppendTexts`D`E`\nset`ListBox_1`InsertTexts`0`X`Y`\nset`ListBox_1`RemoveRows`1,2`\n";
+        auto result = parser.parseAll(val);
+
+        QCOMPARE(result.size(), 3);
+        QVERIFY(result[2].error.isEmpty());
+        QCOMPARE(result[0].value, "D`E");
+        QCOMPARE(result[1].value, "0`X`Y");
+        QCOMPARE(result[2].value, "1,2");
+    }
+
     void good_parse_multiple_requests() {
         RequestParser parser;
         QString val = "new`Button_1`Type`Button`\nset`Button_1`Text`OK`\n";
@@ -105,6 +146,19 @@ private slots:
         QCOMPARE(result[1].value, "Button");
     }
 
+    void good_parse_large_batch() {
+        RequestParser parser;
+        QString val;
+        for (int i = 0; i < 5000; i++) {
+            val += "set`Label_1`Text`Line " + QString::number(i) + "`\n";
+        }
+        auto result = parser.parseAll(val);
+
+        QCOMPARE(result.size(), 5000);
+        QVERIFY(result[4999].error.isEmpty());
+        QCOMPARE(result[4999].value, "Line 4999");
+    }
+
     void bad_parse_multiple_requests_but_second_misses_value() {
         RequestParser parser;
         QString val = "new`Button_1`Type`Button`\nset`Button_1`Text`";
@@ -164,6 +218,144 @@ private slots:
         QVERIFY(result[0].error.contains("must end with a separator"));
     }
 
+    void good_feed_in_pieces() {
+        RequestParser parser;
+
+        auto result = parser.feed("set`Label_1`Te");
+        QCOMPARE(result.size(), 0);
+
+        result = parser.feed("xt`Hello`\nget`Label_1`");
+        QCOMPARE(result.size(), 1);
+        QCOMPARE(result[0].prop, "Text");
+        QCOMPARE(result[0].value, "Hello");
+
+        result = parser.feed("Text`");
+        QCOMPARE(result.size(), 1);
+        QCOMPARE(result[0].action, "get");
+
+        QCOMPARE(parser.finish().size(), 0);
+    }
+
+    void good_feed_entire_waits_for_line_end() {
+        RequestParser parser;
+
+        auto result = parser.feed("set`ListBox_1`EntireTexts`A`B`");
+        QCOMPARE(result.size(), 0);
+
+        result = parser.feed("C`\n");
+        QCOMPARE(result.size(), 1);
+        QCOMPARE(result[0].value, "A`B`C");
+    }
+
+    void good_feed_long_list_value_in_many_pieces() {
+        RequestParser parser;
+        QList<Request> result = parser.feed("set`ListBox_1`EntireTexts`");
+
+        QStringList items;
+        for (int i = 0; i < 1000; i++) {
+            items.append("Item" + QString::number(i));
+            result += parser.feed(("Item" + QString::number(i) + "`").toUtf8());
+        }
+        QCOMPARE(result.size(), 0);
+
+        result = parser.feed("\nset`Label_1`Text`Done`\n");
+
+        QCOMPARE(result.size(), 2);
+        QCOMPARE(result[0].value, items.join('`'));
+        QCOMPARE(result[1].name, "Label_1");
+        QCOMPARE(result[1].value, "Done");
+    }
+
+    void good_feed_list_value_ends_unfinished_at_finish() {
+        RequestParser parser;
+
+        QCOMPARE(parser.feed("set`ListBox_1`EntireTexts`A`B`").size(), 0);
+        QCOMPARE(parser.feed("C`").size(), 0);
+
+        auto result = parser.finish();
+        QCOMPARE(result.size(), 1);
+        QCOMPARE(result[0].value, "A`B`C");
+    }
+
+    void good_feed_split_utf8() {
+        RequestParser parser;
+        QByteArray bytes = QString("set`Label_1`Text`\u00e4`").toUtf8();
+
+        auto result = parser.feed(bytes.left(18));
+        result += parser.feed(bytes.mid(18));
+
+        QCOMPARE(result.size(), 1);
+        QCOMPARE(result[0].value, QString("\u00e4"));
+    }
+
+    void good_feed_events_at_end() {
+        RequestParser parser;
+
+        QCOMPARE(parser.feed("events?").size(), 0);
+
+        auto result = parser.finish();
+        QCOMPARE(result.size(), 1);
+        QCOMPARE(result[0].action, "events?");
+    }
+
+    void bad_feed_missing_separator_at_end() {
+        RequestParser parser;
+
+        QCOMPARE(parser.feed("set`Label_1`Text`Hello").size(), 0);
+
+        auto result = parser.finish();
+        QCOMPARE(result.size(), 1);
+        QCOMPARE(result[0].error, "All requests must end with a separator-char");
+    }
+
+    void bad_feed_stops_after_error() {
+        RequestParser parser;
+
+        auto result = parser.feed("sat`Label_1`Text`Hello`\nset`Label_1`Text`Hi`\n");
+        QCOMPARE(result.size(), 1);
+        QVERIFY(! result[0].error.isEmpty());
+
+        QCOMPARE(parser.feed("set`Label_1`Text`Hi`\n").size(), 0);
+    }
+
+    void good_feed_nothing_after_stop() {
+        RequestParser parser;
+
+        QCOMPARE(parser.feed("set`Label_1`Text`Hello`\nset`ListBox_1`EntireTexts`A`").size(), 1);
+        parser.stop();
+
+        QCOMPARE(parser.feed("B`\nset`Label_1`Text`Hi`\n").size(), 0);
+        QCOMPARE(parser.finish().size(), 0);
+
+        QCOMPARE(parser.feed("set`Label_1`Text`Hi`\n").size(), 1);
+    }
+
+    void good_take_request_id() {
+        QString message = "#17`set`Label_1`Text`Hi`";
+        QString requestId = RequestParser::takeRequestId(message);
+
+        QCOMPARE(requestId, "17");
+        QCOMPARE(message, "set`Label_1`Text`Hi`");
+        QCOMPARE(RequestParser::tagWithRequestId("OK", requestId), "#17`OK");
+    }
+
+    void good_no_request_id() {
+        QString message = "get`Label_1`Text`";
+        QString requestId = RequestParser::takeRequestId(message);
+
+        QVERIFY(requestId.isEmpty());
+        QCOMPARE(message, "get`Label_1`Text`");
+        QCOMPARE(RequestParser::tagWithRequestId("OK`Hi`", requestId), "OK`Hi`");
+    }
+
+    void bad_request_id_without_separator() {
+        QString message = "#17 events?";
+        QString requestId = RequestParser::takeRequestId(message);
+
+        QVERIFY(requestId.isEmpty());
+        QCOMPARE(message, "#17 events?");
+    }
+
 };
 
 QTEST_MAIN(test_requestparser)
@@ -0,0 +1,82 @@
+#include <QObject>
+#include <QTest>
+
+#include "../src/shmring.h"
+
+#include <cstring>
+
+// A ring of 16 bytes in plain memory, laid out like in the shared memory
+// segment: write position at 0, read position at 64, data from 128 on
+class test_shmring : public QObject {
+    Q_OBJECT
+
+private:
+    alignas(64) char memory[128 + 16];
+
+    ShmRing makeRing() {
+        ShmRing ring(memory, 0, 64, 128, 16);
+        ring.initPositions();
+        return ring;
+    }
+
+private slots:
+    void good_write_then_read() {
+        ShmRing ring = makeRing();
+
+        QCOMPARE(ring.write("hello", 5), 5u);
+        QCOMPARE(ring.available(), 5u);
+        QCOMPARE(ring.readAll(), QByteArray("hello"));
+        QCOMPARE(ring.available(), 0u);
+        QVERIFY(ring.readAll().isEmpty());
+    }
+
+    void good_wraparound() {
+        ShmRing ring = makeRing();
+
+        QCOMPARE(ring.write("0123456789", 10), 10u);
+        QCOMPARE(ring.readAll(), QByteArray("0123456789"));
+
+        // Starts at offset 10, continues at the beginning of the data
+        QCOMPARE(ring.write("abcdefghij", 10), 10u);
+        QCOMPARE(ring.readAll(), QByteArray("abcdefghij"));
+    }
+
+    void good_full_ring_takes_only_what_fits() {
+        ShmRing ring = makeRing();
+
+        QCOMPARE(ring.write("0123456789abcdefXYZ", 19), 16u);
+        QCOMPARE(ring.freeSpace(), 0u);
+        QCOMPARE(ring.write("X", 1), 0u);
+
+        QCOMPARE(ring.readAll(), QByteArray("0123456789abcdef"));
+        QCOMPARE(ring.freeSpace(), 16u);
+    }
+
+    void good_positions_wrap_at_32_bit() {
+        ShmRing ring = makeRing();
+
+        // Both positions shortly before 2^32, as after a long session
+        quint32 nearEnd = 0xFFFFFFFAu;
+        std::memcpy(memory, &nearEnd, sizeof(nearEnd));
+        std::memcpy(memory + 64, &nearEnd, sizeof(nearEnd));
+
+        QCOMPARE(ring.write("0123456789", 10), 10u);
+        QCOMPARE(ring.available(), 10u);
+        QCOMPARE(ring.readAll(), QByteArray("0123456789"));
+    }
+
+    void good_skip_all_drops_unread() {
+        ShmRing ring = makeRing();
+
+        ring.write("garbage", 7);
+        ring.skipAll();
+
+        QCOMPARE(ring.available(), 0u);
+        QCOMPARE(ring.write("ok", 2), 2u);
+        QCOMPARE(ring.readAll(), QByteArray("ok"));
+    }
+};
+
+QTEST_MAIN(test_shmring)
+
+#include "test_shmring.moc"